@@ -149,6 +149,8 @@ public:
 	Variant get_var(bool p_allow_objects = false) const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
+	virtual const uint8_t *get_mapped_buffer() const { return nullptr; } ///< read-only view of the whole file mapped in memory, or nullptr if the backend can't map it. Valid until the file is closed.
+	virtual void prefetch(uint64_t p_from = 0, uint64_t p_length = 0) const {} ///< hint that a range (the rest of the file if length is 0) will be read soon, so the OS can fetch it in the background.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
 	virtual String get_line() const;
 	virtual String get_token() const;
@@ -278,10 +278,35 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
 	}
 
+	// Keep the pack mapped in memory when the platform allows it, so opening and reading packed files
+	// doesn't need a file handle and a syscall per read. Only done with a 64-bit address space,
+	// as big packs would exhaust a 32-bit one.
+	if (sizeof(void *) == 8) {
+		Ref<FileAccess> mapped_file = FileAccess::open(p_path, FileAccess::READ);
+		const uint8_t *mapped_data = mapped_file.is_valid() ? mapped_file->get_mapped_buffer() : nullptr;
+		if (mapped_data) {
+			MappedPack mapped_pack;
+			mapped_pack.file = mapped_file;
+			mapped_pack.data = mapped_data;
+			mapped_pack.size = mapped_file->get_length();
+
+			MutexLock lock(mapped_packs_mutex);
+			mapped_packs[p_path] = mapped_pack;
+		}
+	}
+
 	return true;
 }
 
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	if (!p_file->encrypted) {
+		MutexLock lock(mapped_packs_mutex);
+		HashMap<String, MappedPack>::ConstIterator E = mapped_packs.find(p_file->pack);
+		if (E && p_file->offset + p_file->size <= E->value.size) {
+			return memnew(FileAccessPack(p_path, *p_file, E->value.file, E->value.data + p_file->offset));
+		}
+	}
+
 	return memnew(FileAccessPack(p_path, *p_file));
 }
 
@@ -293,7 +318,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -301,7 +328,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -309,7 +336,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -330,7 +359,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -343,21 +372,46 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	uint64_t read_pos = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped) {
+		memcpy(p_dst, mapped + read_pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+void FileAccessPack::prefetch(uint64_t p_from, uint64_t p_length) const {
+	if (p_from >= pf.size) {
+		return;
+	}
+
+	uint64_t length = pf.size - p_from;
+	if (p_length > 0 && p_length < length) {
+		length = p_length;
+	}
+
+	if (mapped) {
+		mapped_pack->prefetch(pf.offset + p_from, length);
+	} else if (f.is_valid()) {
+		f->prefetch(off + p_from, length);
+	}
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -381,11 +435,24 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_pack = Ref<FileAccess>();
+	mapped = nullptr;
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_pack, const uint8_t *p_mapped_data) :
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+
+	if (p_mapped_data) {
+		// The pack stays mapped for as long as this file holds a reference to it.
+		mapped_pack = p_mapped_pack;
+		mapped = p_mapped_data;
+		off = 0;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -407,8 +474,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -777,8 +778,51 @@ static double _bicubic_interp_kernel(double x) {
 	return bc;
 }
 
+// Destination images with fewer pixels than this are scaled on the calling thread,
+// larger ones are split into bands of rows across the WorkerThreadPool.
+#define IMAGE_SCALE_PARALLEL_MIN_PIXELS (256 * 256)
+#define IMAGE_SCALE_ROWS_GRAIN_SIZE 16
+
+typedef void (*ImageScaleRowsFunc)(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_begin, uint32_t p_dst_row_end);
+
+struct ImageScaleRowsData {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint32_t src_width = 0;
+	uint32_t src_height = 0;
+	uint32_t dst_width = 0;
+	uint32_t dst_height = 0;
+};
+
+template <ImageScaleRowsFunc F>
+static void _scale_rows_task(void *p_userdata, uint32_t p_begin, uint32_t p_end) {
+	const ImageScaleRowsData *sd = (const ImageScaleRowsData *)p_userdata;
+	F(sd->src, sd->dst, sd->src_width, sd->src_height, sd->dst_width, sd->dst_height, p_begin, p_end);
+}
+
+template <ImageScaleRowsFunc F>
+static void _scale_rows(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Don't block a pool thread waiting on nested work, it could starve the pool.
+	if ((uint64_t)p_dst_width * p_dst_height < IMAGE_SCALE_PARALLEL_MIN_PIXELS || !pool || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+		F(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, 0, p_dst_height);
+		return;
+	}
+
+	ImageScaleRowsData sd;
+	sd.src = p_src;
+	sd.dst = p_dst;
+	sd.src_width = p_src_width;
+	sd.src_height = p_src_height;
+	sd.dst_width = p_dst_width;
+	sd.dst_height = p_dst_height;
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_range_group_task(&_scale_rows_task<F>, &sd, p_dst_height, IMAGE_SCALE_ROWS_GRAIN_SIZE, false, -1, true, String("ImageScale"));
+	pool->wait_for_group_task_completion(group_task);
+}
+
 template <int CC, typename T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_begin, uint32_t p_dst_row_end) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -793,7 +837,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_row_begin; y < p_dst_row_end; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -865,13 +909,18 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, typename T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_rows<_scale_cubic_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, typename T>
+static void _scale_bilinear_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_begin, uint32_t p_dst_row_end) {
 	constexpr uint32_t FRAC_BITS = 8;
 	constexpr uint32_t FRAC_LEN = (1 << FRAC_BITS);
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_row_begin; i < p_dst_row_end; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -952,6 +1001,11 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	}
 }
 
+template <int CC, typename T>
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_rows<_scale_bilinear_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
 	for (uint32_t i = 0; i < p_dst_height; i++) {
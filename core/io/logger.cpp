@@ -184,8 +184,62 @@ RotatedFileLogger::RotatedFileLogger(const String &p_base_path, int p_max_files)
 	strip_ansi_regex->detach_from_objectdb(); // Note: This RegEx instance will exist longer than ObjectDB, therefore can't be registered in ObjectDB.
 	strip_ansi_regex->compile("\u001b\\[((?:\\d|;)*)([a-zA-Z])");
 #endif // MODULE_REGEX_ENABLED
+
+#ifdef THREADS_ENABLED
+	if (file.is_valid()) {
+		writer_thread.start(_writer_thread_func, this);
+	}
+#endif // THREADS_ENABLED
+}
+
+RotatedFileLogger::~RotatedFileLogger() {
+#ifdef THREADS_ENABLED
+	if (writer_thread.is_started()) {
+		writer_exit.set();
+		writer_semaphore.post();
+		writer_thread.wait_to_finish();
+	}
+#endif // THREADS_ENABLED
+}
+
+#ifdef THREADS_ENABLED
+void RotatedFileLogger::_writer_thread_func(void *p_self) {
+	RotatedFileLogger *self = (RotatedFileLogger *)p_self;
+
+	while (true) {
+		self->writer_semaphore.wait();
+		bool exit = self->writer_exit.is_set();
+
+		{
+			MutexLock file_lock(self->file_mutex);
+			self->_write_pending();
+		}
+
+		if (exit) {
+			break;
+		}
+	}
 }
 
+void RotatedFileLogger::_write_pending() {
+	{
+		MutexLock lock(pending_mutex);
+		SWAP(pending, writing);
+	}
+
+	if (writing.is_empty()) {
+		return;
+	}
+
+	file->store_buffer(writing.ptr(), writing.size());
+	writing.clear();
+
+	if (_flush_stdout_on_print) {
+		file->flush();
+	}
+}
+#endif // THREADS_ENABLED
+
 void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 	if (!should_log(p_err)) {
 		return;
@@ -208,20 +262,51 @@ void RotatedFileLogger::logv(const char *p_format, va_list p_list, bool p_err) {
 		// Strip ANSI escape codes (such as those inserted by `print_rich()`)
 		// before writing to file, as text editors cannot display those
 		// correctly.
-		file->store_string(strip_ansi_regex->sub(String::utf8(buf), "", true));
+		CharString stripped = strip_ansi_regex->sub(String::utf8(buf), "", true).utf8();
+		const uint8_t *data = (const uint8_t *)stripped.get_data();
+		uint32_t size = stripped.length();
 #else
-		file->store_buffer((uint8_t *)buf, len);
+		const uint8_t *data = (const uint8_t *)buf;
+		uint32_t size = len;
 #endif // MODULE_REGEX_ENABLED
 
-		if (len >= static_buf_size) {
-			Memory::free_static(buf);
+#ifdef THREADS_ENABLED
+		bool queued = false;
+		if (!p_err && writer_thread.is_started()) {
+			MutexLock lock(pending_mutex);
+			if (pending.size() + size <= MAX_PENDING_BYTES) {
+				uint32_t ofs = pending.size();
+				pending.resize(ofs + size);
+				memcpy(pending.ptr() + ofs, data, size);
+				queued = true;
+			}
 		}
 
+		if (queued) {
+			writer_semaphore.post();
+		} else {
+			// Errors are written right away so they reach the file even if the process crashes.
+			// Messages queued before are written first to keep the order.
+			MutexLock file_lock(file_mutex);
+			_write_pending();
+			file->store_buffer(data, size);
+			if (p_err || _flush_stdout_on_print) {
+				file->flush();
+			}
+		}
+#else
+		file->store_buffer(data, size);
+
 		if (p_err || _flush_stdout_on_print) {
 			// Don't always flush when printing stdout to avoid performance
 			// issues when `print()` is spammed in release builds.
 			file->flush();
 		}
+#endif // THREADS_ENABLED
+
+		if (len >= static_buf_size) {
+			Memory::free_static(buf);
+		}
 	}
 }
 
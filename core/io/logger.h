@@ -32,7 +32,12 @@
 #define LOGGER_H
 
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/vector.h"
 #include "modules/modules_enabled.gen.h" // For regex.
 #ifdef MODULE_REGEX_ENABLED
@@ -80,6 +85,8 @@ public:
  * of it with timestamp appended to the file name. Maximum number of backups is configurable.
  * When maximum is reached, the oldest backups are erased. With the maximum being equal to 1,
  * it acts as a simple file logger.
+ * When threads are available, regular messages are written to the file by a background thread,
+ * errors are still written (and flushed) right away by the logging thread.
  */
 class RotatedFileLogger : public Logger {
 	String base_path;
@@ -90,6 +97,24 @@ class RotatedFileLogger : public Logger {
 	void clear_old_backups();
 	void rotate_file();
 
+#ifdef THREADS_ENABLED
+	// Messages waiting for the writer thread. Past this size, messages are written synchronously.
+	static const uint32_t MAX_PENDING_BYTES = 1024 * 1024;
+
+	BinaryMutex pending_mutex;
+	LocalVector<uint8_t> pending;
+
+	BinaryMutex file_mutex;
+	LocalVector<uint8_t> writing; // Protected by file_mutex.
+
+	Thread writer_thread;
+	Semaphore writer_semaphore;
+	SafeFlag writer_exit;
+
+	static void _writer_thread_func(void *p_self);
+	void _write_pending(); // file_mutex must be locked.
+#endif // THREADS_ENABLED
+
 #ifdef MODULE_REGEX_ENABLED
 	Ref<RegEx> strip_ansi_regex;
 #endif // MODULE_REGEX_ENABLED
@@ -98,6 +123,8 @@ public:
 	explicit RotatedFileLogger(const String &p_base_path, int p_max_files = 10);
 
 	virtual void logv(const char *p_format, va_list p_list, bool p_err) override _PRINTF_FORMAT_ATTRIBUTE_2_0;
+
+	virtual ~RotatedFileLogger();
 };
 
 class CompositeLogger : public Logger {
@@ -153,20 +153,35 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	return OK;
 }
 
+String ResourceLoaderBinary::_read_utf8_string(uint32_t p_len) {
+	String s;
+
+	// Files mapped in memory (e.g. inside a mapped pack) are parsed in place, without copying to str_buf first.
+	const uint8_t *mapped = f->get_mapped_buffer();
+	const uint64_t pos = f->get_position();
+	if (mapped && pos + p_len <= f->get_length()) {
+		const char *str = (const char *)mapped + pos;
+		s.parse_utf8(str, strnlen(str, p_len));
+		f->seek(pos + p_len);
+		return s;
+	}
+
+	if ((int)p_len > str_buf.size()) {
+		str_buf.resize(p_len);
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], p_len);
+	s.parse_utf8(&str_buf[0]);
+	return s;
+}
+
 StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
-		String s;
-		s.parse_utf8(&str_buf[0]);
-		return s;
+		return _read_utf8_string(len);
 	}
 
 	return string_map[id];
@@ -698,6 +713,18 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	}
+
+	if (!use_sub_threads) {
+		// Dependencies are loaded one after another on this thread below,
+		// let the OS read the following ones in the background meanwhile.
+		for (int i = 1; i < external_resources.size(); i++) {
+			ResourceLoader::prefetch(external_resources[i].path);
+		}
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
 		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
 		if (!external_resources[i].load_token.is_valid()) {
 			if (!ResourceLoader::get_abort_on_missing_resources()) {
@@ -929,16 +956,10 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
-	if (len == 0) {
+	if (len <= 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
-	String s;
-	s.parse_utf8(&str_buf[0]);
-	return s;
+	return _read_utf8_string(len);
 }
 
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
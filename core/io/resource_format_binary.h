@@ -55,6 +55,7 @@ class ResourceLoaderBinary {
 	Vector<StringName> string_map;
 
 	StringName _get_string();
+	String _read_utf8_string(uint32_t p_len);
 
 	struct ExtResource {
 		String path;
@@ -410,6 +410,8 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 			if (pending_unlock) {
 				ResourceCache::lock.unlock();
 			}
+
+			_retain_resource(load_task.local_path, load_task.resource);
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -579,6 +581,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 				if (existing.is_valid()) {
 					//referencing is fine
 					load_task.resource = existing;
+					_touch_retained_resource(local_path);
 					load_task.status = THREAD_LOAD_LOADED;
 					load_task.progress = 1.0;
 					DEV_ASSERT(!thread_load_tasks.has(local_path));
@@ -1248,6 +1251,18 @@ String ResourceLoader::import_remap(const String &p_path) {
 	return p_path;
 }
 
+void ResourceLoader::prefetch(const String &p_path) {
+	String local_path = _validate_local_path(p_path);
+	if (ResourceCache::has(local_path)) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(import_remap(_path_remap(local_path)), FileAccess::READ);
+	if (f.is_valid()) {
+		f->prefetch();
+	}
+}
+
 String ResourceLoader::path_remap(const String &p_path) {
 	return _path_remap(p_path);
 }
@@ -1300,6 +1315,60 @@ void ResourceLoader::clear_translation_remaps() {
 	}
 }
 
+void ResourceLoader::_retained_resource_evicted(String &p_path, Ref<Resource> &p_resource) {
+	retained_resources_evicted.push_back(p_resource);
+}
+
+void ResourceLoader::_release_evicted_resources(MutexLock<Mutex> &p_lock) {
+	if (retained_resources_evicted.is_empty()) {
+		return;
+	}
+	LocalVector<Ref<Resource>> evicted = retained_resources_evicted;
+	retained_resources_evicted.clear();
+	p_lock.temp_unlock();
+	// Resources without other users are freed here.
+	evicted.clear();
+	p_lock.temp_relock();
+}
+
+void ResourceLoader::_retain_resource(const String &p_path, const Ref<Resource> &p_resource) {
+	if (max_retained_resources <= 0 || p_path.is_empty()) {
+		return;
+	}
+
+	MutexLock lock(retained_resources_mutex);
+	retained_resources.insert(p_path, p_resource);
+	_release_evicted_resources(lock);
+}
+
+void ResourceLoader::_touch_retained_resource(const String &p_path) {
+	if (max_retained_resources <= 0) {
+		return;
+	}
+
+	// Only marks the entry as recently used, nothing gets evicted (and possibly freed) from here.
+	MutexLock lock(retained_resources_mutex);
+	retained_resources.getptr(p_path);
+}
+
+void ResourceLoader::set_max_retained_resources(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	MutexLock lock(retained_resources_mutex);
+	max_retained_resources = p_count;
+	if (p_count == 0) {
+		retained_resources.clear();
+	} else {
+		retained_resources.set_capacity(p_count);
+	}
+	_release_evicted_resources(lock);
+}
+
+void ResourceLoader::clear_retained_resources() {
+	MutexLock lock(retained_resources_mutex);
+	retained_resources.clear();
+	_release_evicted_resources(lock);
+}
+
 void ResourceLoader::clear_thread_load_tasks() {
 	// Bring the thing down as quickly as possible without causing deadlocks or leaks.
 
@@ -1450,6 +1519,11 @@ bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
 bool ResourceLoader::timestamp_on_load = false;
 
+Mutex ResourceLoader::retained_resources_mutex;
+LRUCache<String, Ref<Resource>, HashMapHasherDefault, HashMapComparatorDefault<String>, ResourceLoader::_retained_resource_evicted> ResourceLoader::retained_resources;
+LocalVector<Ref<Resource>> ResourceLoader::retained_resources_evicted;
+int ResourceLoader::max_retained_resources = 0;
+
 thread_local int ResourceLoader::load_nesting = 0;
 thread_local Vector<String> ResourceLoader::load_paths_stack;
 thread_local HashMap<int, HashMap<String, Ref<Resource>>> ResourceLoader::res_ref_overrides;
@@ -36,6 +36,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/lru.h"
 
 class ConditionVariable;
 
@@ -157,6 +158,19 @@ private:
 	static HashMap<String, Vector<String>> translation_remaps;
 	static HashMap<String, String> path_remaps;
 
+	// Recently loaded resources kept alive after their last user is gone, so loading them again is instant.
+	// Dropping the last reference to a resource frees it, which may need other loader locks. So entries
+	// evicted with retained_resources_mutex held are moved to retained_resources_evicted, and only released
+	// after unlocking (see _release_evicted_resources()).
+	static Mutex retained_resources_mutex;
+	static void _retained_resource_evicted(String &p_path, Ref<Resource> &p_resource);
+	static LRUCache<String, Ref<Resource>, HashMapHasherDefault, HashMapComparatorDefault<String>, _retained_resource_evicted> retained_resources;
+	static LocalVector<Ref<Resource>> retained_resources_evicted;
+	static int max_retained_resources;
+	static void _release_evicted_resources(MutexLock<Mutex> &p_lock);
+	static void _retain_resource(const String &p_path, const Ref<Resource> &p_resource);
+	static void _touch_retained_resource(const String &p_path);
+
 	static String _path_remap(const String &p_path, bool *r_translation_remapped = nullptr);
 	friend class Resource;
 
@@ -277,6 +291,7 @@ public:
 
 	static String path_remap(const String &p_path);
 	static String import_remap(const String &p_path);
+	static void prefetch(const String &p_path);
 
 	static void load_path_remaps();
 	static void clear_path_remaps();
@@ -287,6 +302,10 @@ public:
 
 	static void clear_thread_load_tasks();
 
+	static void set_max_retained_resources(int p_count);
+	static int get_max_retained_resources() { return max_retained_resources; }
+	static void clear_retained_resources();
+
 	static void set_load_callback(ResourceLoadedCallback p_callback);
 	static ResourceLoaderImport import;
 
@@ -31,6 +31,8 @@
 #include "expression.h"
 
 #include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/variant/variant_internal.h"
 
 Error Expression::_get_token(Token &r_token) {
 	while (true) {
@@ -1275,6 +1277,30 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 				}
 			}
 
+			// Compute signature (types of operands) so the validated evaluator can be used when it matches.
+			// Operands whose types differ from the cached ones (e.g. inputs changing type between executions) take the checked path.
+			uint32_t actual_signature = (a.get_type() << 8) | b.get_type();
+			uint32_t cached_signature = op->op_signature.get();
+			if (likely(cached_signature != 0 && cached_signature == actual_signature)) {
+				VariantInternal::initialize(&r_ret, op->op_return_type);
+				op->op_func(&a, &b, &r_ret);
+				break;
+			}
+
+			// Don't optimize division and modulo since there's no check for division by zero with validated calls.
+			if (cached_signature == 0 && actual_signature != 0 && op->op != Variant::OP_DIVIDE && op->op != Variant::OP_MODULE) {
+				static Mutex initializer_mutex;
+				MutexLock lock(initializer_mutex);
+				Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(op->op, a.get_type(), b.get_type());
+				// Check again in case another thread already set it.
+				if (op_func && op->op_signature.get() == 0) {
+					op->op_return_type = Variant::get_operator_return_type(op->op, a.get_type(), b.get_type());
+					op->op_func = op_func;
+					// Published last, so readers that see the signature also see the evaluator.
+					op->op_signature.set(actual_signature);
+				}
+			}
+
 			bool valid = true;
 			Variant::evaluate(op->op, a, b, r_ret, valid);
 			if (!valid) {
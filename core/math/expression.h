@@ -32,6 +32,7 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/safe_refcount.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -173,6 +174,12 @@ private:
 
 		ENode *nodes[2] = { nullptr, nullptr };
 
+		// Operand types seen on the first run, used to call the validated evaluator directly on later runs.
+		// Set only once: op_return_type and op_func are written before op_signature is published, and never change after.
+		mutable SafeNumeric<uint32_t> op_signature;
+		mutable Variant::Type op_return_type = Variant::NIL;
+		mutable Variant::ValidatedOperatorEvaluator op_func = nullptr;
+
 		OperatorNode() {
 			type = TYPE_OPERATOR;
 		}
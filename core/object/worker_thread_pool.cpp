@@ -50,6 +50,33 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
+void WorkerThreadPool::_process_group_range(Task *p_task, uint32_t p_begin, uint32_t p_end, bool &r_do_post) {
+	if (p_task->group->ranged) {
+		if (p_task->native_range_group_func) {
+			p_task->native_range_group_func(p_task->native_func_userdata, p_begin, p_end);
+		} else {
+			p_task->template_userdata->callback_ranged(p_begin, p_end);
+		}
+	} else {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			if (p_task->native_group_func) {
+				p_task->native_group_func(p_task->native_func_userdata, i);
+			} else if (p_task->template_userdata) {
+				p_task->template_userdata->callback_indexed(i);
+			} else {
+				p_task->callable.call(i);
+			}
+		}
+	}
+
+	// This is the only way to ensure posting is done when all tasks are really complete.
+	uint32_t completed_amount = p_task->group->completed_index.add(p_end - p_begin);
+
+	if (completed_amount == p_task->group->max) {
+		r_do_post = true;
+	}
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
@@ -84,30 +111,34 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #ifdef THREADS_ENABLED
 	bool low_priority = p_task->low_priority;
 #endif
+	LocalVector<Task *> ready_dependents;
 
 	if (p_task->group) {
 		// Handling a group
+		Group *group = p_task->group;
 		bool do_post = false;
 
-		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
-
-			if (work_index >= p_task->group->max) {
-				break;
-			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
+		if (group->partition_count) {
+			// Start with the partition assigned to this thread, then help with the rest.
+			uint32_t first_partition = p_task->pool_thread_index >= 0 ? p_task->pool_thread_index % group->partition_count : 0;
+			for (uint32_t i = 0; i < group->partition_count; i++) {
+				uint32_t partition = (first_partition + i) % group->partition_count;
+				uint32_t partition_end = uint64_t(group->max) * (partition + 1) / group->partition_count;
+				while (true) {
+					uint32_t begin = group->partition_indices[partition].postadd(group->grain_size);
+					if (begin >= partition_end) {
+						break;
+					}
+					_process_group_range(p_task, begin, MIN(begin + group->grain_size, partition_end), do_post);
+				}
 			}
-
-			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
-
-			if (completed_amount == p_task->group->max) {
-				do_post = true;
+		} else {
+			while (true) {
+				uint32_t begin = group->index.postadd(group->grain_size);
+				if (begin >= group->max) {
+					break;
+				}
+				_process_group_range(p_task, begin, MIN(begin + group->grain_size, group->max), do_post);
 			}
 		}
 
@@ -118,6 +149,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (do_post) {
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
+
+			// Must happen before signaling this task is finished, since that may lead to freeing the group.
+			MutexLock task_lock(task_mutex);
+			_release_dependents(p_task->group->dependents, ready_dependents);
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -145,6 +180,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_release_dependents(p_task->dependents, ready_dependents);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -176,14 +212,21 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
+
+	if (ready_dependents.size()) {
+		MutexLock task_lock(task_mutex);
+		_post_ready_dependents(ready_dependents, task_lock);
+	}
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Fast path: take work from the thread queues without locking.
+		Task *task_to_process = singleton->_pop_thread_task(thread_data);
+
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 
 			bool exit = singleton->_handle_runlevel(thread_data, lock);
@@ -197,7 +240,13 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
 			} else {
-				thread_data->cond_var.wait(lock);
+				// Thread queues are only pushed to with the mutex locked, and steal() only fails
+				// when a queue is empty (not when losing a race), so anything still queued is
+				// found here. What's pushed after this check is notified once we wait.
+				task_to_process = singleton->_pop_thread_task(thread_data);
+				if (!task_to_process) {
+					thread_data->cond_var.wait(lock);
+				}
 			}
 		}
 
@@ -233,7 +282,11 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			// Tasks posted from a pool thread go to its own queue, where they are likely
+			// to be picked by the same thread, but can also be stolen by idle ones.
+			if (!caller_pool_thread || !caller_pool_thread->work_queue.push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -324,11 +377,97 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+// Pops from the thread's own queue, or steals from the others' otherwise.
+WorkerThreadPool::Task *WorkerThreadPool::_pop_thread_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->work_queue.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		if (victim.work_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_thread_tasks() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].work_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+uint32_t WorkerThreadPool::_add_dependencies(Task *p_task, const LocalVector<TaskID> &p_dependencies) {
+	for (TaskID dependency_id : p_dependencies) {
+		ERR_CONTINUE_MSG(dependency_id <= 0 || dependency_id >= (TaskID)last_task, vformat("Invalid dependency Task or Group ID: %d.", dependency_id));
+
+		Task **taskp = tasks.getptr(dependency_id);
+		if (taskp) {
+			if (!(*taskp)->completed) {
+				(*taskp)->dependents.push_back(p_task);
+				p_task->pending_dependencies++;
+			}
+			continue;
+		}
+
+		Group **groupp = groups.getptr(dependency_id);
+		if (groupp) {
+			// Completion is flagged before releasing dependents, which needs the mutex, so this can't miss it.
+			if (!(*groupp)->completed.is_set()) {
+				(*groupp)->dependents.push_back(p_task);
+				p_task->pending_dependencies++;
+			}
+			continue;
+		}
+
+		// Otherwise, it was already completed and awaited.
+	}
+	return p_task->pending_dependencies;
+}
+
+void WorkerThreadPool::_release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_ready) {
+	for (Task *dependent : p_dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			r_ready.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_ready_dependents(LocalVector<Task *> &p_ready, MutexLock<BinaryMutex> &p_lock) {
+	// Tasks keep the priority they were added with, so post high priority ones first and then the rest.
+	uint32_t high_priority_count = 0;
+	for (uint32_t i = 0; i < p_ready.size(); i++) {
+		if (!p_ready[i]->low_priority) {
+			SWAP(p_ready[i], p_ready[high_priority_count]);
+			high_priority_count++;
+		}
+	}
+	if (high_priority_count) {
+		_post_tasks(p_ready.ptr(), high_priority_count, true, p_lock);
+	}
+	if (high_priority_count < p_ready.size()) {
+		_post_tasks(p_ready.ptr() + high_priority_count, p_ready.size() - high_priority_count, false, p_lock);
+	}
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const LocalVector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, &p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const LocalVector<TaskID> *p_dependencies) {
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	// Get a free task
@@ -340,8 +479,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
 
+	if (p_dependencies && _add_dependencies(task, *p_dependencies)) {
+		// Will be posted once the last dependency completes.
+		return id;
+	}
+
 	_post_tasks(&task, 1, p_high_priority, lock);
 
 	return id;
@@ -479,7 +624,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_thread_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -497,7 +642,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (singleton->task_queue.first()) {
+			task_to_process = _pop_thread_task(p_caller_pool_thread);
+			if (!task_to_process && task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
 			}
@@ -543,7 +689,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_thread_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -606,8 +752,9 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	td.cond_var.notify_one();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_grain_size, bool p_ranged, bool p_keep_affinity, int p_tasks, bool p_high_priority, const String &p_description, const LocalVector<TaskID> *p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
+	ERR_FAIL_COND_V(p_grain_size < 1, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
 	}
@@ -618,8 +765,18 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	GroupID id = last_task++;
 	group->max = p_elements;
 	group->self = id;
+	group->grain_size = MIN(p_grain_size, MAX(p_elements, 1));
+	group->ranged = p_ranged;
+	if (p_keep_affinity && threads.size() > 1 && p_elements > 0) {
+		group->partition_count = threads.size();
+		group->partition_indices = memnew_arr(SafeNumeric<uint32_t>, group->partition_count);
+		for (uint32_t i = 0; i < group->partition_count; i++) {
+			group->partition_indices[i].set(uint64_t(p_elements) * i / group->partition_count);
+		}
+	}
 
 	Task **tasks_posted = nullptr;
+	uint32_t tasks_ready = 0;
 	if (p_elements == 0) {
 		// Should really not call it with zero Elements, but at least it should work.
 		group->completed.set_to(true);
@@ -636,29 +793,43 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		for (int i = 0; i < p_tasks; i++) {
 			Task *task = task_allocator.alloc();
 			task->native_group_func = p_func;
+			task->native_range_group_func = p_range_func;
 			task->native_func_userdata = p_userdata;
 			task->description = p_description;
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
-			tasks_posted[i] = task;
+			task->low_priority = !p_high_priority;
 			// No task ID is used.
+			if (p_dependencies && _add_dependencies(task, *p_dependencies)) {
+				continue; // Will be posted once the last dependency completes.
+			}
+			tasks_posted[tasks_ready++] = task;
 		}
 	}
 
 	groups[id] = group;
 
-	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock);
+	_post_tasks(tasks_posted, tasks_ready, p_high_priority, lock);
 
 	return id;
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(Callable(), p_func, nullptr, p_userdata, nullptr, p_elements, 1, false, false, p_tasks, p_high_priority, p_description);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const LocalVector<TaskID> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, nullptr, p_userdata, nullptr, p_elements, 1, false, false, p_tasks, p_high_priority, p_description, &p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_grain_size, bool p_keep_affinity, int p_tasks, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_NULL_V(p_func, INVALID_TASK_ID);
+	return _add_group_task(Callable(), nullptr, p_func, p_userdata, nullptr, p_elements, p_grain_size, true, p_keep_affinity, p_tasks, p_high_priority, p_description);
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, nullptr, p_elements, 1, false, false, p_tasks, p_high_priority, p_description);
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
@@ -40,6 +40,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -57,6 +58,7 @@ private:
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
 		virtual void callback_indexed(uint32_t p_index) {}
+		virtual void callback_ranged(uint32_t p_begin, uint32_t p_end) {}
 		virtual ~BaseTemplateUserdata() {}
 	};
 
@@ -69,6 +71,19 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		uint32_t grain_size = 1;
+		bool ranged = false;
+		// If set, elements are split into one partition per pool thread, each one
+		// processed first by the thread with the same index, for cache locality across runs.
+		SafeNumeric<uint32_t> *partition_indices = nullptr;
+		uint32_t partition_count = 0;
+		LocalVector<Task *> dependents; // Tasks to release when the group completes.
+
+		~Group() {
+			if (partition_indices) {
+				memdelete_arr(partition_indices);
+			}
+		}
 	};
 
 	struct Task {
@@ -76,6 +91,7 @@ private:
 		Callable callable;
 		void (*native_func)(void *) = nullptr;
 		void (*native_group_func)(void *, uint32_t) = nullptr;
+		void (*native_range_group_func)(void *, uint32_t, uint32_t) = nullptr;
 		void *native_func_userdata = nullptr;
 		String description;
 		Semaphore done_semaphore; // For user threads awaiting.
@@ -88,6 +104,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0; // The task is not queued until this reaches zero.
+		LocalVector<Task *> dependents; // Tasks to release when this one completes.
 
 		void free_template_userdata();
 		Task() :
@@ -98,6 +116,7 @@ private:
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint32_t THREAD_TASK_QUEUE_SIZE = 1024;
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -119,6 +138,8 @@ private:
 		Task *current_task = nullptr;
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		// Tasks posted from this thread. Other threads can steal from it without taking the task mutex.
+		WorkStealingDeque<Task *, THREAD_TASK_QUEUE_SIZE> work_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -169,12 +190,20 @@ private:
 	static void _thread_function(void *p_user);
 
 	void _process_task(Task *task);
+	_FORCE_INLINE_ void _process_group_range(Task *p_task, uint32_t p_begin, uint32_t p_end, bool &r_do_post);
 
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	uint32_t _add_dependencies(Task *p_task, const LocalVector<TaskID> &p_dependencies);
+	void _release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_ready);
+	void _post_ready_dependents(LocalVector<Task *> &p_ready, MutexLock<BinaryMutex> &p_lock);
+
+	Task *_pop_thread_task(ThreadData *p_thread_data);
+	bool _has_thread_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -186,8 +215,8 @@ private:
 	static thread_local UnlockableLocks unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const LocalVector<TaskID> *p_dependencies = nullptr);
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_grain_size, bool p_ranged, bool p_keep_affinity, int p_tasks, bool p_high_priority, const String &p_description, const LocalVector<TaskID> *p_dependencies = nullptr);
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -209,6 +238,16 @@ private:
 		}
 	};
 
+	template <typename C, typename M, typename U>
+	struct RangeGroupUserData : public BaseTemplateUserdata {
+		C *instance;
+		M method;
+		U userdata;
+		virtual void callback_ranged(uint32_t p_begin, uint32_t p_end) override {
+			(instance->*method)(p_begin, p_end, userdata);
+		}
+	};
+
 	void _wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task);
 
 	void _switch_runlevel(Runlevel p_runlevel);
@@ -237,6 +276,19 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// These variants only queue the task once all the tasks or groups in p_dependencies have completed,
+	// so independent stages can be chained up front without a blocking wait in between.
+	template <typename C, typename M, typename U>
+	TaskID add_template_task_with_dependencies(C *p_instance, M p_method, U p_userdata, const LocalVector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, &p_dependencies);
+	}
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const LocalVector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -250,9 +302,34 @@ public:
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, 1, false, false, p_tasks, p_high_priority, p_description);
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <typename C, typename M, typename U>
+	GroupID add_template_group_task_with_dependencies(C *p_instance, M p_method, U p_userdata, int p_elements, const LocalVector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, 1, false, false, p_tasks, p_high_priority, p_description, &p_dependencies);
+	}
+	GroupID add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const LocalVector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	// Like group tasks, but the callback is given a [begin, end) range of at most p_grain_size elements,
+	// so fine-grained work doesn't pay the dispatch cost per element. With p_keep_affinity, the range
+	// processed by each pool thread is kept stable across submissions with the same element count.
+	template <typename C, typename M, typename U>
+	GroupID add_template_range_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_grain_size = 1, bool p_keep_affinity = false, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef RangeGroupUserData<C, M, U> RangeGroupUD;
+		RangeGroupUD *ud = memnew(RangeGroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, p_grain_size, true, p_keep_affinity, p_tasks, p_high_priority, p_description);
+	}
+	GroupID add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_grain_size = 1, bool p_keep_affinity = false, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
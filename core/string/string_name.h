@@ -48,7 +48,11 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Buckets are guarded by a fixed set of mutexes, so unrelated names don't contend on one lock.
+		STRING_TABLE_LOCK_BITS = 6,
+		STRING_TABLE_LOCK_LEN = 1 << STRING_TABLE_LOCK_BITS,
+		STRING_TABLE_LOCK_MASK = STRING_TABLE_LOCK_LEN - 1
 	};
 
 	struct _Data {
@@ -81,6 +85,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static inline Mutex mutex;
+	static inline Mutex table_mutexes[STRING_TABLE_LOCK_LEN];
+	static _FORCE_INLINE_ Mutex &_get_table_mutex(uint32_t p_idx) { return table_mutexes[p_idx & STRING_TABLE_LOCK_MASK]; }
 	static void setup();
 	static void cleanup();
 	static uint32_t get_empty_hash();
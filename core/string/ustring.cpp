@@ -2046,6 +2046,29 @@ String String::utf8(const char *p_utf8, int p_len) {
 	return ret;
 }
 
+// Checks 8 bytes at once for a run of plain ASCII, without NUL and optionally without CR,
+// which UTF-8 parsing can then copy as is.
+static _FORCE_INLINE_ bool _is_plain_ascii_run(const char *p_ptr, bool p_reject_cr) {
+	const uint64_t low_bits = 0x0101010101010101ULL;
+	const uint64_t high_bits = 0x8080808080808080ULL;
+
+	uint64_t word;
+	memcpy(&word, p_ptr, sizeof(word));
+	if (word & high_bits) {
+		return false;
+	}
+	if ((word - low_bits) & ~word & high_bits) {
+		return false; // Has a NUL byte.
+	}
+	if (p_reject_cr) {
+		const uint64_t cr_xor = word ^ (low_bits * '\r');
+		if ((cr_xor - low_bits) & ~cr_xor & high_bits) {
+			return false;
+		}
+	}
+	return true;
+}
+
 Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	if (!p_utf8) {
 		return ERR_INVALID_DATA;
@@ -2076,6 +2099,13 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		int skip = 0;
 		uint8_t c_start = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (skip == 0 && ptrtmp_limit && ptrtmp_limit - ptrtmp >= 8 && _is_plain_ascii_run(ptrtmp, p_skip_cr)) {
+				str_size += 8;
+				cstr_size += 8;
+				ptrtmp += 8;
+				continue;
+			}
+
 #if CHAR_MIN == 0
 			uint8_t c = *ptrtmp;
 #else
@@ -2148,6 +2178,16 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	int skip = 0;
 	uint32_t unichar = 0;
 	while (cstr_size) {
+		// The validation pass stopped at the first NUL, and CRs aren't counted, so cstr_size bytes are readable.
+		if (skip == 0 && cstr_size >= 8 && _is_plain_ascii_run(p_utf8, p_skip_cr)) {
+			for (int i = 0; i < 8; i++) {
+				*(dst++) = uint8_t(p_utf8[i]);
+			}
+			cstr_size -= 8;
+			p_utf8 += 8;
+			continue;
+		}
+
 #if CHAR_MIN == 0
 		uint8_t c = *p_utf8;
 #else
@@ -2235,6 +2275,12 @@ CharString String::utf8() const {
 	const char32_t *d = &operator[](0);
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
+		if (i + 4 <= l && (d[i] | d[i + 1] | d[i + 2] | d[i + 3]) <= 0x7f) {
+			// Fast path for runs of ASCII.
+			fl += 4;
+			i += 3;
+			continue;
+		}
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
 			fl += 1;
@@ -2267,6 +2313,14 @@ CharString String::utf8() const {
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
+		if (i + 4 <= l && (d[i] | d[i + 1] | d[i + 2] | d[i + 3]) <= 0x7f) {
+			APPEND_CHAR(d[i]);
+			APPEND_CHAR(d[i + 1]);
+			APPEND_CHAR(d[i + 2]);
+			APPEND_CHAR(d[i + 3]);
+			i += 3;
+			continue;
+		}
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
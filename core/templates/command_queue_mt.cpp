@@ -37,5 +37,32 @@ CommandQueueMT::CommandQueueMT() {
 	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
 }
 
+void CommandQueueMT::set_single_producer(bool p_enable, uint32_t p_ring_size_kb) {
+	ERR_FAIL_COND_MSG(command_mem.size() || ring_read.get() != ring_write, "The command queue mode can only be changed while it's empty.");
+
+	if (ring) {
+		memfree(ring);
+		ring = nullptr;
+	}
+	ring_size = 0;
+	ring_write = 0;
+	ring_unpublished = 0;
+	ring_published.set(0);
+	ring_read.set(0);
+	ring_consumer_thread_id.set(Thread::UNASSIGNED_ID);
+
+	single_producer = p_enable;
+	if (single_producer) {
+		ring_size = next_power_of_2(MAX(p_ring_size_kb, 1u) * 1024);
+		ring = (uint8_t *)memalloc(ring_size);
+		producer_thread_id = Thread::get_caller_id();
+	} else {
+		producer_thread_id = Thread::UNASSIGNED_ID;
+	}
+}
+
 CommandQueueMT::~CommandQueueMT() {
+	if (ring) {
+		memfree(ring);
+	}
 }
@@ -251,6 +251,14 @@
 #define DECL_PUSH(N)                                                            \
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>    \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) {    \
+		if (single_producer) {                                                  \
+			CMD_TYPE(N) *cmd = _ring_allocate<CMD_TYPE(N)>();                   \
+			cmd->instance = p_instance;                                         \
+			cmd->method = p_method;                                             \
+			SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                \
+			_ring_commit();                                                     \
+			return;                                                             \
+		}                                                                       \
 		MutexLock mlock(mutex);                                                 \
 		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>();                             \
 		cmd->instance = p_instance;                                             \
@@ -266,6 +274,15 @@
 #define DECL_PUSH_AND_RET(N)                                                                   \
 	template <typename T, typename M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) typename R>       \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
+		if (single_producer) {                                                                 \
+			CMD_RET_TYPE(N) *cmd = _ring_allocate<CMD_RET_TYPE(N)>();                          \
+			cmd->instance = p_instance;                                                        \
+			cmd->method = p_method;                                                            \
+			SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                               \
+			cmd->ret = r_ret;                                                                  \
+			_ring_commit_and_sync();                                                           \
+			return;                                                                            \
+		}                                                                                      \
 		MutexLock mlock(mutex);                                                                \
 		CMD_RET_TYPE(N) *cmd = allocate<CMD_RET_TYPE(N)>();                                    \
 		cmd->instance = p_instance;                                                            \
@@ -284,6 +301,14 @@
 #define DECL_PUSH_AND_SYNC(N)                                                         \
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>          \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
+		if (single_producer) {                                                        \
+			CMD_SYNC_TYPE(N) *cmd = _ring_allocate<CMD_SYNC_TYPE(N)>();               \
+			cmd->instance = p_instance;                                               \
+			cmd->method = p_method;                                                   \
+			SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                      \
+			_ring_commit_and_sync();                                                  \
+			return;                                                                   \
+		}                                                                             \
 		MutexLock mlock(mutex);                                                       \
 		CMD_SYNC_TYPE(N) *cmd = allocate<CMD_SYNC_TYPE(N)>();                         \
 		cmd->instance = p_instance;                                                   \
@@ -326,6 +351,8 @@ class CommandQueueMT {
 	/***** BASE *******/
 
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
+	static const uint32_t DEFAULT_RING_SIZE_KB = 1024;
+	static const uint32_t RING_PUBLISH_BATCH_SIZE = 64;
 
 	BinaryMutex mutex;
 	LocalVector<uint8_t> command_mem;
@@ -336,6 +363,20 @@ class CommandQueueMT {
 	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	uint64_t flush_read_ptr = 0;
 
+	// Single-producer mode. Commands are written to a fixed ring buffer without locking,
+	// and made visible to the consumer in batches. Positions grow monotonically.
+	bool single_producer = false;
+	Thread::ID producer_thread_id = Thread::UNASSIGNED_ID;
+	uint8_t *ring = nullptr;
+	uint64_t ring_size = 0;
+	uint64_t ring_write = 0; // Only accessed by the producer.
+	uint32_t ring_unpublished = 0; // Only accessed by the producer.
+	SafeNumeric<uint64_t> ring_published; // Written by the producer.
+	SafeNumeric<uint64_t> ring_read; // Written by the consumer.
+	// Any thread may flush, but only one may consume at a time; it claims this atomically before reading.
+	std::atomic<Thread::ID> ring_flusher = Thread::UNASSIGNED_ID;
+	SafeNumeric<Thread::ID> ring_consumer_thread_id; // Last thread that flushed.
+
 	template <typename T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
@@ -347,6 +388,132 @@ class CommandQueueMT {
 		return cmd;
 	}
 
+	template <typename T>
+	T *_ring_allocate() {
+		DEV_ASSERT(Thread::get_caller_id() == producer_thread_id);
+		uint64_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1)) + 8;
+		uint64_t pos = ring_write & (ring_size - 1);
+		// Commands must be contiguous; if it doesn't fit until the end, a zero-size marker tells to skip to the start.
+		uint64_t skip = pos + alloc_size > ring_size ? ring_size - pos : 0;
+		CRASH_COND_MSG(alloc_size > ring_size, "Command doesn't fit in the command queue ring buffer.");
+
+		while (unlikely(ring_write + skip + alloc_size - ring_read.get() > ring_size)) {
+			_ring_wait_for_space();
+		}
+
+		if (skip) {
+			*(uint64_t *)&ring[pos] = 0;
+			ring_write += skip;
+			pos = 0;
+		}
+		*(uint64_t *)&ring[pos] = alloc_size - 8;
+		T *cmd = memnew_placement(&ring[pos + 8], T);
+		ring_write += alloc_size;
+		return cmd;
+	}
+
+	_FORCE_INLINE_ void _ring_commit() {
+		ring_unpublished++;
+		if (unlikely(ring_unpublished >= RING_PUBLISH_BATCH_SIZE)) {
+			_ring_publish();
+		}
+	}
+
+	void _ring_commit_and_sync() {
+		MutexLock mlock(mutex);
+		sync_tail++;
+		_ring_publish();
+		_wait_for_sync(mlock);
+	}
+
+	void _ring_publish() {
+		if (ring_published.get() == ring_write) {
+			return;
+		}
+		ring_published.set(ring_write);
+		ring_unpublished = 0;
+		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		}
+	}
+
+	void _ring_wait_for_space() {
+		_ring_publish();
+		Thread::ID consumer = ring_consumer_thread_id.get();
+		if ((consumer == producer_thread_id || consumer == Thread::UNASSIGNED_ID) && ring_flusher.load() == Thread::UNASSIGNED_ID) {
+			// Either the producer is also the consumer, or nobody has consumed yet; either way, nobody else will make room.
+			// If another thread claims the ring first, this flush returns and we try again.
+			_ring_flush();
+		} else {
+			// Everything is published already, so make sure the consumer is awake.
+			if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+			}
+			OS::get_singleton()->delay_usec(1);
+		}
+	}
+
+	void _ring_flush() {
+		Thread::ID caller = Thread::get_caller_id();
+		if (unlikely(ring_flusher.load() == caller)) {
+			// Re-entrant call.
+			return;
+		}
+
+		if (caller == producer_thread_id) {
+			_ring_publish();
+		}
+
+		do {
+			Thread::ID expected = Thread::UNASSIGNED_ID;
+			if (!ring_flusher.compare_exchange_strong(expected, caller)) {
+				// Another thread is consuming. It checks for commands published meanwhile before giving up the ring.
+				return;
+			}
+			ring_consumer_thread_id.set(caller);
+			_ring_consume();
+			ring_flusher.store(Thread::UNASSIGNED_ID);
+		} while (unlikely(ring_read.get() != ring_published.get()));
+	}
+
+	void _ring_consume() {
+		uint64_t read = ring_read.get();
+		uint64_t write = ring_published.get();
+		bool synced = false;
+		while (read < write) {
+			uint64_t pos = read & (ring_size - 1);
+			uint64_t size = *(uint64_t *)&ring[pos];
+			if (size == 0) {
+				read += ring_size - pos;
+			} else {
+				CommandBase *cmd = reinterpret_cast<CommandBase *>(&ring[pos + 8]);
+				cmd->call();
+				bool sync = cmd->sync;
+				cmd->~CommandBase();
+				read += 8 + size;
+
+				if (unlikely(sync)) {
+					ring_read.set(read);
+					MutexLock lock(mutex);
+					sync_head++;
+					sync_cond_var.notify_all();
+					synced = true;
+				}
+			}
+			ring_read.set(read);
+
+			if (read == write) {
+				// Catch up with anything published meanwhile.
+				write = ring_published.get();
+			}
+		}
+
+		if (unlikely(synced)) {
+			MutexLock lock(mutex);
+			_prevent_sync_wraparound();
+		}
+	}
+
 	_FORCE_INLINE_ void _prevent_sync_wraparound() {
 		bool safe_to_reset = !sync_awaiters;
 		bool already_sync_to_latest = sync_head == sync_tail;
@@ -421,15 +588,45 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
+		if (single_producer) {
+			// ring_unpublished may only be read by the producer.
+			if (Thread::get_caller_id() == producer_thread_id) {
+				if (ring_unpublished || ring_read.get() != ring_published.get()) {
+					_ring_flush();
+				}
+			} else if (ring_read.get() != ring_published.get()) {
+				_ring_flush();
+			}
+			return;
+		}
 		if (unlikely(command_mem.size() > 0)) {
 			_flush();
 		}
 	}
 
 	void flush_all() {
+		if (single_producer) {
+			_ring_flush();
+			return;
+		}
 		_flush();
 	}
 
+	// In single-producer mode, makes commands pushed so far visible to the consumer.
+	// Otherwise, they are only published in batches or when syncing.
+	void publish() {
+		if (single_producer) {
+			_ring_publish();
+		}
+	}
+
+	// The calling thread becomes the only one allowed to push commands, which avoids locking on push at all.
+	// Must be done while the queue is empty. If the ring buffer is full, pushing waits for the consumer to make room,
+	// or makes room by itself if no other thread has consumed yet.
+	// The server queues don't enable this, since their public API may be called from any thread.
+	void set_single_producer(bool p_enable, uint32_t p_ring_size_kb = DEFAULT_RING_SIZE_KB);
+	bool is_single_producer() const { return single_producer; }
+
 	void sync() {
 		push_and_sync(this, &CommandQueueMT::_no_op);
 	}
@@ -437,6 +634,10 @@ public:
 	void wait_and_flush() {
 		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
 		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+		if (single_producer) {
+			_ring_flush();
+			return;
+		}
 		_flush();
 	}
 
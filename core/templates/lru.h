@@ -35,7 +35,8 @@
 #include "hash_map.h"
 #include "list.h"
 
-template <typename TKey, typename TData, typename Hasher = HashMapHasherDefault, typename Comparator = HashMapComparatorDefault<TKey>>
+// BeforeEvict, if set, is called with each entry right before it's dropped (evicted, replaced or cleared).
+template <typename TKey, typename TData, typename Hasher = HashMapHasherDefault, typename Comparator = HashMapComparatorDefault<TKey>, void (*BeforeEvict)(TKey &, TData &) = nullptr>
 class LRUCache {
 private:
 	struct Pair {
@@ -61,6 +62,9 @@ public:
 		Element n = _list.push_front(Pair(p_key, p_value));
 
 		if (e) {
+			if constexpr (BeforeEvict != nullptr) {
+				BeforeEvict((*e)->get().key, (*e)->get().data);
+			}
 			_list.erase(*e);
 			_map.erase(p_key);
 		}
@@ -68,6 +72,9 @@ public:
 
 		while (_map.size() > capacity) {
 			Element d = _list.back();
+			if constexpr (BeforeEvict != nullptr) {
+				BeforeEvict(d->get().key, d->get().data);
+			}
 			_map.erase(d->get().key);
 			_list.pop_back();
 		}
@@ -76,6 +83,11 @@ public:
 	}
 
 	void clear() {
+		if constexpr (BeforeEvict != nullptr) {
+			for (Pair &pair : _list) {
+				BeforeEvict(pair.key, pair.data);
+			}
+		}
 		_map.clear();
 		_list.clear();
 	}
@@ -109,6 +121,9 @@ public:
 			capacity = p_capacity;
 			while (_map.size() > capacity) {
 				Element d = _list.back();
+				if constexpr (BeforeEvict != nullptr) {
+					BeforeEvict(d->get().key, d->get().data);
+				}
 				_map.erase(d->get().key);
 				_list.pop_back();
 			}
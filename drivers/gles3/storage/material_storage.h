@@ -595,6 +595,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_shader, const StringName &p_name) const override;
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override;
+	virtual void shader_warm_up_pipelines(RID p_shader) override {}
 
 	/* MATERIAL API */
 
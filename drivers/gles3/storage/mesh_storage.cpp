@@ -1974,6 +1974,52 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+
+	// Stride of the incoming data, colors and custom data are packed into half floats internally.
+	uint32_t xform_stride = multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	uint32_t old_stride = xform_stride;
+	old_stride += multimesh->uses_colors ? 4 : 0;
+	old_stride += multimesh->uses_custom_data ? 4 : 0;
+	ERR_FAIL_COND(p_buffer.size() % old_stride != 0);
+	int count = p_buffer.size() / old_stride;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + count > multimesh->instances);
+	if (count == 0) {
+		return;
+	}
+
+	// Goes through the data cache like the per-instance setters, so only the dirty regions get uploaded.
+	_multimesh_make_local(multimesh);
+
+	const float *r = p_buffer.ptr();
+	float *w = multimesh->data_cache.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		const float *dataptr = r + i * old_stride;
+		float *newptr = w + (p_first_instance + i) * multimesh->stride_cache;
+		memcpy(newptr, dataptr, xform_stride * sizeof(float));
+
+		if (multimesh->uses_colors) {
+			const float *color = dataptr + xform_stride;
+			uint16_t val[4] = { Math::make_half_float(color[0]), Math::make_half_float(color[1]), Math::make_half_float(color[2]), Math::make_half_float(color[3]) };
+			memcpy(newptr + multimesh->color_offset_cache, val, 2 * 4);
+		}
+		if (multimesh->uses_custom_data) {
+			const float *custom = dataptr + xform_stride + (multimesh->uses_colors ? 4 : 0);
+			uint16_t val[4] = { Math::make_half_float(custom[0]), Math::make_half_float(custom[1]), Math::make_half_float(custom[2]), Math::make_half_float(custom[3]) };
+			memcpy(newptr + multimesh->custom_data_offset_cache, val, 2 * 4);
+		}
+	}
+
+	uint32_t first_region = p_first_instance / MULTIMESH_DIRTY_REGION_SIZE;
+	uint32_t last_region = (p_first_instance + count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+	for (uint32_t i = first_region; i <= last_region; i++) {
+		_multimesh_mark_dirty(multimesh, i * MULTIMESH_DIRTY_REGION_SIZE, true);
+	}
+}
+
 Vector<float> MeshStorage::_multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_buffer) {
+		munmap(mapped_buffer, mapped_size);
+		mapped_buffer = nullptr;
+		mapped_size = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -228,6 +235,42 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::get_mapped_buffer() const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped_buffer) {
+		return mapped_buffer;
+	}
+
+	// Only files opened for reading are mapped, writes would not be seen through a private mapping.
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		return nullptr;
+	}
+
+	void *data = mmap(nullptr, (size_t)length, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapped_buffer = (uint8_t *)data;
+	mapped_size = length;
+	return mapped_buffer;
+}
+
+void FileAccessUnix::prefetch(uint64_t p_from, uint64_t p_length) const {
+	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
+
+#ifdef POSIX_FADV_WILLNEED
+	// Only a hint, the read is started asynchronously by the kernel and failures don't matter.
+	posix_fadvise(fileno(f), p_from, p_length, POSIX_FADV_WILLNEED);
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -49,6 +49,9 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	mutable uint8_t *mapped_buffer = nullptr;
+	mutable uint64_t mapped_size = 0;
+
 	void _close();
 
 public:
@@ -68,6 +71,8 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_buffer() const override;
+	virtual void prefetch(uint64_t p_from = 0, uint64_t p_length = 0) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
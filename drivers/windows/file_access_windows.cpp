@@ -230,6 +230,15 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (mapped_buffer) {
+		UnmapViewOfFile(mapped_buffer);
+		mapped_buffer = nullptr;
+	}
+	if (mapping_handle) {
+		CloseHandle((HANDLE)mapping_handle);
+		mapping_handle = nullptr;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -341,6 +350,44 @@ uint64_t FileAccessWindows::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 	return read;
 }
 
+const uint8_t *FileAccessWindows::get_mapped_buffer() const {
+	ERR_FAIL_NULL_V(f, nullptr);
+
+	if (mapped_buffer) {
+		return mapped_buffer;
+	}
+
+	// Only files opened for reading are mapped, the view is never written to.
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		return nullptr;
+	}
+
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(f));
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		return nullptr;
+	}
+
+	void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data) {
+		CloseHandle(mapping);
+		return nullptr;
+	}
+
+	mapping_handle = mapping;
+	mapped_buffer = (uint8_t *)data;
+	return mapped_buffer;
+}
+
 Error FileAccessWindows::get_error() const {
 	return last_error;
 }
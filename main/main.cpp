@@ -44,6 +44,7 @@
 #include "core/io/file_access_zip.h"
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
+#include "core/io/json.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
@@ -193,6 +194,7 @@ static String locale;
 static String log_file;
 static bool show_help = false;
 static uint64_t quit_after = 0;
+static String benchmark_frames_file;
 static OS::ProcessID editor_pid = 0;
 #ifdef TOOLS_ENABLED
 static bool found_project = false;
@@ -649,6 +651,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--benchmark-frames-file <path>", "Record per-frame CPU times and save their statistics to a given file in JSON format on exit. Physics and navigation times add up all physics steps of a frame.\n");
+	print_help_option("", "Combine with --fixed-fps, --quit-after and --headless to benchmark a scene reproducibly.\n");
 
 	print_help_title("Standalone tools");
 	print_help_option("-s, --script <script>", "Run a script.\n");
@@ -1716,6 +1720,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--benchmark-frames-file") {
+			if (N) {
+				benchmark_frames_file = N->get();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --benchmark-frames-file <path>.\n");
+				goto error;
+			}
 		} else if (arg == "--profile-gpu") {
 			profile_gpu = true;
 		} else if (arg == "--disable-crash-handler") {
@@ -2525,6 +2537,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	Engine::get_singleton()->set_physics_jitter_fix(GLOBAL_DEF("physics/common/physics_jitter_fix", 0.5));
 	Engine::get_singleton()->set_max_fps(GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/max_fps", PROPERTY_HINT_RANGE, "0,1000,1"), 0));
 
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_cache/max_retained_resources", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
+	if (!editor && !project_manager) {
+		// The editor must see resources freed and reloaded from disk as usual.
+		ResourceLoader::set_max_retained_resources(GLOBAL_GET("memory/limits/resource_cache/max_retained_resources"));
+	}
+
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/output_latency", PROPERTY_HINT_RANGE, "1,100,1"), 15);
 	// Use a safer default output_latency for web to avoid audio cracking on low-end devices, especially mobile.
 	GLOBAL_DEF_RST("audio/driver/output_latency.web", 50);
@@ -4264,6 +4282,59 @@ static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
 
+// Per-frame times (in microseconds) recorded for --benchmark-frames-file.
+static LocalVector<uint64_t> benchmark_frame_ticks;
+static LocalVector<uint64_t> benchmark_process_ticks;
+static LocalVector<uint64_t> benchmark_physics_process_ticks;
+static LocalVector<uint64_t> benchmark_navigation_process_ticks;
+
+static Dictionary _get_benchmark_frame_stats(LocalVector<uint64_t> &p_ticks) {
+	Dictionary stats;
+	if (p_ticks.is_empty()) {
+		return stats;
+	}
+
+	uint64_t total = 0;
+	for (uint64_t ticks : p_ticks) {
+		total += ticks;
+	}
+	p_ticks.sort();
+
+	const uint32_t count = p_ticks.size();
+	stats["mean"] = double(total) / count;
+	stats["min"] = p_ticks[0];
+	stats["p50"] = p_ticks[(count - 1) * 50 / 100];
+	stats["p90"] = p_ticks[(count - 1) * 90 / 100];
+	stats["p99"] = p_ticks[(count - 1) * 99 / 100];
+	stats["max"] = p_ticks[count - 1];
+	return stats;
+}
+
+static void _benchmark_frames_dump() {
+	if (benchmark_frames_file.is_empty()) {
+		return;
+	}
+
+	Dictionary results;
+	results["frames"] = benchmark_frame_ticks.size();
+	results["frame_usec"] = _get_benchmark_frame_stats(benchmark_frame_ticks);
+	results["process_usec"] = _get_benchmark_frame_stats(benchmark_process_ticks);
+	results["physics_process_usec"] = _get_benchmark_frame_stats(benchmark_physics_process_ticks);
+	results["navigation_process_usec"] = _get_benchmark_frame_stats(benchmark_navigation_process_ticks);
+
+	Ref<FileAccess> f = FileAccess::open(benchmark_frames_file, FileAccess::WRITE);
+	if (f.is_valid()) {
+		f->store_string(JSON::stringify(results, "\t", false, true));
+	} else {
+		ERR_PRINT("Couldn't write frame benchmark results to: " + benchmark_frames_file);
+	}
+
+	benchmark_frame_ticks.reset();
+	benchmark_process_ticks.reset();
+	benchmark_physics_process_ticks.reset();
+	benchmark_navigation_process_ticks.reset();
+}
+
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
 // to be set explicitly here (defaults to EXIT_SUCCESS).
@@ -4292,6 +4363,9 @@ bool Main::iteration() {
 	uint64_t physics_process_ticks = 0;
 	uint64_t process_ticks = 0;
 	uint64_t navigation_process_ticks = 0;
+	// Summed over all physics steps of the frame, unlike the above which keep the largest step.
+	uint64_t physics_process_frame_ticks = 0;
+	uint64_t navigation_process_frame_ticks = 0;
 
 	frame += ticks_elapsed;
 
@@ -4352,6 +4426,7 @@ bool Main::iteration() {
 		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
+		navigation_process_frame_ticks += OS::get_singleton()->get_ticks_usec() - navigation_begin;
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
 
 		message_queue->flush();
@@ -4369,6 +4444,7 @@ bool Main::iteration() {
 		OS::get_singleton()->get_main_loop()->iteration_end();
 
 		physics_process_ticks = MAX(physics_process_ticks, OS::get_singleton()->get_ticks_usec() - physics_begin); // keep the largest one for reference
+		physics_process_frame_ticks += OS::get_singleton()->get_ticks_usec() - physics_begin;
 		physics_process_max = MAX(OS::get_singleton()->get_ticks_usec() - physics_begin, physics_process_max);
 
 		Engine::get_singleton()->_in_physics = false;
@@ -4415,6 +4491,13 @@ bool Main::iteration() {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
 
+	if (!benchmark_frames_file.is_empty()) {
+		benchmark_frame_ticks.push_back(frame_time);
+		benchmark_process_ticks.push_back(process_ticks);
+		benchmark_physics_process_ticks.push_back(physics_process_frame_ticks);
+		benchmark_navigation_process_ticks.push_back(navigation_process_frame_ticks);
+	}
+
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
@@ -4514,6 +4597,8 @@ void Main::cleanup(bool p_force) {
 		ERR_FAIL_COND(!_start_success);
 	}
 
+	_benchmark_frames_dump();
+
 #ifdef DEBUG_ENABLED
 	if (input) {
 		input->flush_frame_parsed_events();
@@ -4529,6 +4614,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceLoader::clear_retained_resources();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
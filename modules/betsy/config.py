@@ -1,5 +1,17 @@
 def can_build(env, platform):
-    return env.editor_build
+    return env.editor_build or env["betsy_runtime"]
+
+
+def get_opts(platform):
+    from SCons.Variables import BoolVariable
+
+    return [
+        BoolVariable(
+            "betsy_runtime",
+            "Build the betsy GPU texture compressor into export templates, for runtime Image.compress()",
+            False,
+        ),
+    ]
 
 
 def configure(env):
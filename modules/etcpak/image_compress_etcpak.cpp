@@ -30,6 +30,7 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
@@ -88,6 +89,85 @@ void _compress_bc(Image *r_img, Image::UsedChannels p_channels) {
 	_compress_etcpak(_determine_dxt_type(p_channels), r_img);
 }
 
+// etcpak encodes blocks in row-major order, so any run of whole block rows can be
+// compressed independently given matching source and destination offsets.
+static void _compress_etcpak_blocks(EtcpakType p_compress_type, const uint32_t *p_src, uint64_t *p_dst, uint32_t p_blocks, uint32_t p_width) {
+	switch (p_compress_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressDxt1Dither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressDxt5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+static uint32_t _get_etcpak_block_words(EtcpakType p_compress_type) {
+	switch (p_compress_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			return 2;
+		default:
+			return 1;
+	}
+}
+
+// Mip levels with fewer blocks than this are compressed on the calling thread.
+#define ETCPAK_PARALLEL_MIN_BLOCKS 4096
+
+struct EtcpakCompressJob {
+	EtcpakType compress_type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t width = 0;
+	uint32_t block_words = 1;
+};
+
+static void _compress_etcpak_block_rows(void *p_userdata, uint32_t p_begin, uint32_t p_end) {
+	const EtcpakCompressJob *job = (const EtcpakCompressJob *)p_userdata;
+	const uint32_t blocks_per_row = job->width / 4;
+	_compress_etcpak_blocks(job->compress_type, job->src + (size_t)p_begin * 4 * job->width, job->dst + (size_t)p_begin * blocks_per_row * job->block_words, (p_end - p_begin) * blocks_per_row, job->width);
+}
+
 void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -253,48 +333,20 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 			src_mip_read = padded_src.ptr();
 		}
 
-		switch (p_compress_type) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressDxt5(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		// Don't block a pool thread waiting on nested work, as textures may already be imported in parallel.
+		if (blocks < ETCPAK_PARALLEL_MIN_BLOCKS || !pool || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+			_compress_etcpak_blocks(p_compress_type, src_mip_read, dest_mip_write, blocks, dest_mip_w);
+		} else {
+			EtcpakCompressJob job;
+			job.compress_type = p_compress_type;
+			job.src = src_mip_read;
+			job.dst = dest_mip_write;
+			job.width = dest_mip_w;
+			job.block_words = _get_etcpak_block_words(p_compress_type);
+
+			WorkerThreadPool::GroupID group_task = pool->add_native_range_group_task(&_compress_etcpak_block_rows, &job, dest_mip_h / 4, 4, false, -1, true, String("EtcpakCompress"));
+			pool->wait_for_group_task_completion(group_task);
 		}
 	}
 
@@ -447,6 +447,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_lambda_function_pos(p_lambda_function));
 	}
 
+	void append_call_cache() {
+		// Storage for the receiver class and method bind cached by the VM on the first call.
+		constexpr int _pointer_size = sizeof(void *) / sizeof(*(opcodes.ptr()));
+		for (int i = 0; i < 2 * _pointer_size; i++) {
+			append(0);
+		}
+	}
+
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
 	}
@@ -141,6 +141,40 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_TYPED(m_op_name, m_v_type, m_op) \
+	case OPCODE_OPERATOR_##m_op_name##_##m_v_type: {          \
+		text += "operator (";                                \
+		text += #m_v_type;                                   \
+		text += ") ";                                        \
+		text += DADDR(3);                                    \
+		text += " = ";                                       \
+		text += DADDR(1);                                    \
+		text += " " m_op " ";                                \
+		text += DADDR(2);                                    \
+		incr += 4;                                           \
+	} break
+
+				DISASSEMBLE_OPERATOR_TYPED(ADD, INT, "+");
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, INT, "-");
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, INT, "*");
+				DISASSEMBLE_OPERATOR_TYPED(EQUAL, INT, "==");
+				DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL, INT, "!=");
+				DISASSEMBLE_OPERATOR_TYPED(LESS, INT, "<");
+				DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL, INT, "<=");
+				DISASSEMBLE_OPERATOR_TYPED(GREATER, INT, ">");
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL, INT, ">=");
+				DISASSEMBLE_OPERATOR_TYPED(ADD, FLOAT, "+");
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, FLOAT, "-");
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, FLOAT, "*");
+				DISASSEMBLE_OPERATOR_TYPED(DIVIDE, FLOAT, "/");
+				DISASSEMBLE_OPERATOR_TYPED(LESS, FLOAT, "<");
+				DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL, FLOAT, "<=");
+				DISASSEMBLE_OPERATOR_TYPED(GREATER, FLOAT, ">");
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL, FLOAT, ">=");
+				DISASSEMBLE_OPERATOR_TYPED(ADD, VECTOR3, "+");
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, VECTOR3, "-");
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, VECTOR3_FLOAT, "*");
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -698,7 +732,8 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				constexpr int _pointer_size = sizeof(void *) / sizeof(*_code_ptr);
+				incr = 5 + argc + 2 * _pointer_size;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
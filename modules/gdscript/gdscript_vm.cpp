@@ -232,6 +232,26 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                  \
+		&&OPCODE_OPERATOR_EQUAL_INT,                     \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_LESS_INT,                      \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,                \
+		&&OPCODE_OPERATOR_GREATER_INT,                   \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,                \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                  \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                    \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,              \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,                 \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,           \
+		&&OPCODE_OPERATOR_ADD_VECTOR3,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR3,              \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,        \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -818,6 +838,42 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_op_name, m_v_type, m_left, m_right, m_ret, m_op) \
+	OPCODE(OPCODE_OPERATOR_##m_op_name##_##m_v_type) {                           \
+		CHECK_SPACE(4);                                                         \
+		GET_VARIANT_PTR(a, 0);                                                  \
+		GET_VARIANT_PTR(b, 1);                                                  \
+		GET_VARIANT_PTR(dst, 2);                                                \
+		const m_left &left = *VariantGetInternalPtr<m_left>::get_ptr(a);        \
+		const m_right &right = *VariantGetInternalPtr<m_right>::get_ptr(b);     \
+		m_ret result = left m_op right;                                         \
+		VariantTypeChanger<m_ret>::change(dst);                                 \
+		*VariantGetInternalPtr<m_ret>::get_ptr(dst) = result;                   \
+		ip += 4;                                                                \
+	}                                                                           \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD, INT, int64_t, int64_t, int64_t, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, INT, int64_t, int64_t, int64_t, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, INT, int64_t, int64_t, int64_t, *);
+			OPCODE_OPERATOR_TYPED(EQUAL, INT, int64_t, int64_t, bool, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL, INT, int64_t, int64_t, bool, !=);
+			OPCODE_OPERATOR_TYPED(LESS, INT, int64_t, int64_t, bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, INT, int64_t, int64_t, bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER, INT, int64_t, int64_t, bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, INT, int64_t, int64_t, bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD, FLOAT, double, double, double, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, FLOAT, double, double, double, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, FLOAT, double, double, double, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE, FLOAT, double, double, double, /);
+			OPCODE_OPERATOR_TYPED(LESS, FLOAT, double, double, bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, FLOAT, double, double, bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER, FLOAT, double, double, bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, FLOAT, double, double, bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD, VECTOR3, Vector3, Vector3, Vector3, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, VECTOR3, Vector3, Vector3, Vector3, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, VECTOR3_FLOAT, Vector3, double, Vector3, *);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1857,8 +1913,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #ifdef DEBUG_ENABLED
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
+				constexpr int _pointer_size = sizeof(void *) / sizeof(*_code_ptr);
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(3 + instr_arg_count + 2 * _pointer_size);
 
 				ip += instr_arg_count;
 
@@ -1872,6 +1929,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				// Inline cache: if the receiver is a native object without a script, reuse the method
+				// resolved on the first call from this site as long as the class is the same.
+				MethodBind *cached_method = nullptr;
+				Object *cached_obj = base->get_type() == Variant::OBJECT ? base->get_validated_object() : nullptr;
+				if (cached_obj && !cached_obj->get_script_instance()) {
+					const void **cache_class = reinterpret_cast<const void **>(&_code_ptr[ip + 3]);
+					MethodBind **cache_method = reinterpret_cast<MethodBind **>(&_code_ptr[ip + 3 + _pointer_size]);
+					const StringName &obj_class = cached_obj->get_class_name();
+
+					if (likely(*cache_class == obj_class.data_unique_pointer())) {
+						cached_method = *cache_method;
+					} else if (unlikely(*cache_class == nullptr)) {
+						// Extension classes can be unloaded, so only cache methods of engine classes.
+						ClassDB::APIType api = ClassDB::get_api_type(obj_class);
+						if (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR) {
+							cached_method = ClassDB::get_method(obj_class, *methodname);
+							if (cached_method) {
+								static Mutex initializer_mutex;
+								MutexLock lock(initializer_mutex);
+								// Check again in case another thread already set it. The class is stored last so it never matches a missing method.
+								if (*cache_class == nullptr) {
+									*cache_method = cached_method;
+									*cache_class = obj_class.data_unique_pointer();
+								}
+							}
+						}
+					}
+				}
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1885,9 +1971,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				if (cached_method) {
+					temp_ret = cached_method->call(cached_obj, (const Variant **)argptrs, argc, err);
+				} else {
+					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+				}
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1916,8 +2006,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1967,7 +2055,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 3 + 2 * _pointer_size;
 			}
 			DISPATCH_OPCODE;
 
@@ -2536,8 +2624,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					gdfs->state.stack.resize(alloca_size);
 
 					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					// The frame is destroyed right after this, so relocate the values instead of copying them
+					// (copies of types stored out of line, like Transform3D, would allocate) and leave nils behind.
+					if (_stack_size > 3) {
+						memcpy(&gdfs->state.stack.write[sizeof(Variant) * 3], (void *)&stack[3], sizeof(Variant) * (_stack_size - 3));
+						for (int i = 3; i < _stack_size; i++) {
+							memnew_placement(&stack[i], Variant);
+						}
 					}
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
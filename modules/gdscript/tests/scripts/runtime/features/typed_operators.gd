@@ -0,0 +1,31 @@
+# Operations on typed int, float and Vector3 operands use dedicated opcodes.
+
+func test():
+	var a := 7
+	var b := 2
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+
+	var x := 7.0
+	var y := 2.0
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+	print(x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	var u := Vector3(1, 2, 3)
+	var v := Vector3(4, 5, 6)
+	print(u + v, " ", v - u, " ", u * y)
+
+	# Result stored in a variable that currently holds another type.
+	var untyped = "string"
+	untyped = a + b
+	print(untyped, " ", typeof(untyped) == TYPE_INT)
+	untyped = x < y
+	print(untyped, " ", typeof(untyped) == TYPE_BOOL)
+
+	# Target is also an operand.
+	var sum := 0
+	for i in 10:
+		sum = sum + i
+	print(sum)
+	v = v - u
+	print(v)
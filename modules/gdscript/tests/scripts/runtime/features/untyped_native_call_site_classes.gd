@@ -0,0 +1,27 @@
+# A single untyped call site must dispatch correctly when the receiver class changes.
+
+class Scripted extends RefCounted:
+	func describe():
+		return "scripted"
+
+func describe_all(objects):
+	var result := []
+	for object in objects:
+		result.push_back(object.get_class())
+	return result
+
+func test():
+	var node := Node.new()
+	var node_2d := Node2D.new()
+	var objects = [node, node_2d, RefCounted.new(), Scripted.new(), node]
+	print(describe_all(objects))
+	print(describe_all(objects))
+
+	var untyped = Scripted.new()
+	print(untyped.describe())
+	untyped = node_2d
+	untyped.set_name("Renamed")
+	print(untyped.get_name())
+
+	node.free()
+	node_2d.free()
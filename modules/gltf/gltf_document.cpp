@@ -43,6 +43,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/3d/bone_attachment_3d.h"
 #include "scene/3d/camera_3d.h"
@@ -814,6 +815,9 @@ Error GLTFDocument::_parse_buffers(Ref<GLTFState> p_state, const String &p_base_
 				int byteLength = buffer["byteLength"];
 				ERR_FAIL_COND_V(byteLength < buffer_data.size(), ERR_PARSE_ERROR);
 				p_state->buffers.push_back(buffer_data);
+			} else {
+				// Buffers without data, such as EXT_meshopt_compression fallbacks, still keep their index.
+				p_state->buffers.push_back(Vector<uint8_t>());
 			}
 		}
 	}
@@ -887,6 +891,14 @@ Error GLTFDocument::_parse_buffer_views(Ref<GLTFState> p_state) {
 			buffer_view->vertex_attributes = target == GLTFDocument::ARRAY_BUFFER;
 		}
 
+		if (d.has("extensions")) {
+			const Dictionary &extensions = d["extensions"];
+			if (extensions.has("EXT_meshopt_compression") && SurfaceTool::decode_vertex_buffer_func) {
+				const Error err = _decode_meshopt_buffer_view(p_state, extensions["EXT_meshopt_compression"], buffer_view);
+				ERR_FAIL_COND_V(err != OK, err);
+			}
+		}
+
 		p_state->buffer_views.push_back(buffer_view);
 	}
 
@@ -895,6 +907,81 @@ Error GLTFDocument::_parse_buffer_views(Ref<GLTFState> p_state) {
 	return OK;
 }
 
+Error GLTFDocument::_decode_meshopt_buffer_view(Ref<GLTFState> p_state, const Dictionary &p_meshopt, Ref<GLTFBufferView> p_buffer_view) {
+	// Ref: https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md
+	ERR_FAIL_COND_V(!p_meshopt.has("buffer"), ERR_PARSE_ERROR);
+	ERR_FAIL_COND_V(!p_meshopt.has("byteLength"), ERR_PARSE_ERROR);
+	ERR_FAIL_COND_V(!p_meshopt.has("byteStride"), ERR_PARSE_ERROR);
+	ERR_FAIL_COND_V(!p_meshopt.has("count"), ERR_PARSE_ERROR);
+	ERR_FAIL_COND_V(!p_meshopt.has("mode"), ERR_PARSE_ERROR);
+
+	const GLTFBufferIndex bi = p_meshopt["buffer"];
+	ERR_FAIL_INDEX_V(bi, p_state->buffers.size(), ERR_PARAMETER_RANGE_ERROR);
+	const int64_t byte_offset = p_meshopt.get("byteOffset", 0);
+	const int64_t byte_length = p_meshopt["byteLength"];
+	const int64_t byte_stride = p_meshopt["byteStride"];
+	const int64_t count = p_meshopt["count"];
+	const String mode = p_meshopt["mode"];
+	const String filter = p_meshopt.get("filter", "NONE");
+
+	const Vector<uint8_t> &source = p_state->buffers[bi];
+	ERR_FAIL_COND_V(byte_offset < 0 || byte_length < 0 || byte_offset + byte_length > source.size(), ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(byte_stride <= 0 || count < 0, ERR_FILE_CORRUPT);
+
+	// The meshoptimizer decoders only assert on their parameters, so everything coming from the file is validated here.
+	if (mode == "ATTRIBUTES") {
+		ERR_FAIL_COND_V_MSG(byte_stride % 4 != 0 || byte_stride > 256, ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression attribute stride: " + itos(byte_stride) + ".");
+	} else if (mode == "TRIANGLES" || mode == "INDICES") {
+		ERR_FAIL_COND_V_MSG(byte_stride != 2 && byte_stride != 4, ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression index stride: " + itos(byte_stride) + ".");
+		ERR_FAIL_COND_V_MSG(mode == "TRIANGLES" && count % 3 != 0, ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression triangle index count: " + itos(count) + ".");
+	} else {
+		ERR_FAIL_V_MSG(ERR_PARSE_ERROR, "glTF: Unknown EXT_meshopt_compression mode: " + mode + ".");
+	}
+
+	if (filter == "OCTAHEDRAL") {
+		ERR_FAIL_COND_V_MSG(mode != "ATTRIBUTES" || (byte_stride != 4 && byte_stride != 8), ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression octahedral filter stride: " + itos(byte_stride) + ".");
+	} else if (filter == "QUATERNION") {
+		ERR_FAIL_COND_V_MSG(mode != "ATTRIBUTES" || byte_stride != 8, ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression quaternion filter stride: " + itos(byte_stride) + ".");
+	} else if (filter == "EXPONENTIAL") {
+		ERR_FAIL_COND_V_MSG(mode != "ATTRIBUTES" || byte_stride % 4 != 0, ERR_FILE_CORRUPT, "glTF: Invalid EXT_meshopt_compression exponential filter stride: " + itos(byte_stride) + ".");
+	} else {
+		ERR_FAIL_COND_V_MSG(filter != "NONE", ERR_PARSE_ERROR, "glTF: Unknown EXT_meshopt_compression filter: " + filter + ".");
+	}
+
+	// The stride is at most 256 at this point, so this can't overflow.
+	ERR_FAIL_COND_V_MSG(count > INT32_MAX / byte_stride, ERR_FILE_CORRUPT, "glTF: EXT_meshopt_compression buffer view is too large: " + itos(count) + " elements.");
+
+	Vector<uint8_t> decoded;
+	ERR_FAIL_COND_V(decoded.resize(byte_stride * count) != OK, ERR_OUT_OF_MEMORY);
+	const uint8_t *src = source.ptr() + byte_offset;
+
+	int result = -1;
+	if (mode == "ATTRIBUTES") {
+		result = SurfaceTool::decode_vertex_buffer_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	} else if (mode == "TRIANGLES") {
+		result = SurfaceTool::decode_index_buffer_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	} else {
+		result = SurfaceTool::decode_index_sequence_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	}
+	ERR_FAIL_COND_V_MSG(result != 0, ERR_FILE_CORRUPT, "glTF: Couldn't decode EXT_meshopt_compression buffer view, error " + itos(result) + ".");
+
+	if (filter == "OCTAHEDRAL") {
+		SurfaceTool::decode_filter_oct_func(decoded.ptrw(), count, byte_stride);
+	} else if (filter == "QUATERNION") {
+		SurfaceTool::decode_filter_quat_func(decoded.ptrw(), count, byte_stride);
+	} else if (filter == "EXPONENTIAL") {
+		SurfaceTool::decode_filter_exp_func(decoded.ptrw(), count, byte_stride);
+	}
+
+	// Point the buffer view at the decoded data instead of the fallback buffer.
+	p_state->buffers.push_back(decoded);
+	p_buffer_view->buffer = p_state->buffers.size() - 1;
+	p_buffer_view->byte_offset = 0;
+	p_buffer_view->byte_length = decoded.size();
+
+	return OK;
+}
+
 Error GLTFDocument::_encode_accessors(Ref<GLTFState> p_state) {
 	Array accessors;
 	for (GLTFAccessorIndex i = 0; i < p_state->accessors.size(); i++) {
@@ -1355,7 +1442,7 @@ Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> p_state, double *p_dst, c
 				case COMPONENT_TYPE_BYTE: {
 					int8_t b = int8_t(*src);
 					if (p_normalized) {
-						d = (double(b) / 128.0);
+						d = MAX(double(b) / 127.0, -1.0);
 					} else {
 						d = double(b);
 					}
@@ -1371,7 +1458,7 @@ Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> p_state, double *p_dst, c
 				case COMPONENT_TYPE_SHORT: {
 					int16_t s = *(int16_t *)src;
 					if (p_normalized) {
-						d = (double(s) / 32768.0);
+						d = MAX(double(s) / 32767.0, -1.0);
 					} else {
 						d = double(s);
 					}
@@ -3455,9 +3542,7 @@ Error GLTFDocument::_serialize_images(Ref<GLTFState> p_state) {
 	return OK;
 }
 
-Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension) {
-	Ref<Image> r_image;
-	r_image.instantiate();
+bool GLTFDocument::_parse_image_bytes_with_extensions(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> &r_image, String &r_file_extension) {
 	// Check if any GLTFDocumentExtensions want to import this data as an image.
 	for (Ref<GLTFDocumentExtension> ext : document_extensions) {
 		ERR_CONTINUE(ext.is_null());
@@ -3465,9 +3550,14 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 		ERR_CONTINUE_MSG(err != OK, "glTF: Encountered error " + itos(err) + " when parsing image " + itos(p_index) + " in file " + p_state->filename + ". Continuing.");
 		if (!r_image->is_empty()) {
 			r_file_extension = ext->get_image_file_extension();
-			return r_image;
+			return true;
 		}
 	}
+	return false;
+}
+
+// Doesn't touch the document or the state, so it's safe to run for several images at once.
+static void _parse_image_bytes_as_png_or_jpg(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> &r_image, String &r_file_extension) {
 	// If no extension wanted to import this data as an image, try to load a PNG or JPEG.
 	// First we honor the mime types if they were defined.
 	if (p_mime_type == "image/png") { // Load buffer as PNG.
@@ -3493,7 +3583,24 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 	if (r_image->is_empty()) {
 		ERR_PRINT(vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", p_index, p_mime_type));
 	}
-	return r_image;
+}
+
+struct GLTFParsedImage {
+	bool valid = false;
+	Vector<uint8_t> data;
+	String mime_type;
+	String name;
+	String file_extension;
+	Ref<Image> image;
+	Ref<Texture2D> texture; // Loaded directly from an external file.
+	bool needs_decode = false;
+};
+
+static void _parse_image_decode_task(void *p_userdata, uint32_t p_index) {
+	GLTFParsedImage &parsed = ((GLTFParsedImage *)p_userdata)[p_index];
+	if (parsed.needs_decode) {
+		_parse_image_bytes_as_png_or_jpg(parsed.data, parsed.mime_type, p_index, parsed.image, parsed.file_extension);
+	}
 }
 
 void GLTFDocument::_parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_file_extension, int p_index, Ref<Image> p_image) {
@@ -3603,8 +3710,12 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 	const Array &images = p_state->json["images"];
 	HashSet<String> used_names;
+	LocalVector<GLTFParsedImage> parsed_images;
+	parsed_images.resize(images.size());
+	uint32_t decode_count = 0;
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &dict = images[i];
+		GLTFParsedImage &parsed = parsed_images[i];
 
 		// glTF 2.0 supports PNG and JPEG types, which can be specified as (from spec):
 		// "- a URI to an external file in one of the supported images formats, or
@@ -3619,6 +3730,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		if (dict.has("uri") && dict.has("bufferView")) {
 			WARN_PRINT("Invalid image definition in glTF file using both 'uri' and 'bufferView'. 'uri' will take precedence.");
 		}
+		parsed.valid = true;
 
 		String mime_type;
 		if (dict.has("mimeType")) { // Should be "image/png", "image/jpeg", or something handled by an extension.
@@ -3660,8 +3772,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				// the material), so we only do that only as fallback.
 				Ref<Texture2D> texture = ResourceLoader::load(uri);
 				if (texture.is_valid()) {
-					p_state->images.push_back(texture);
-					p_state->source_images.push_back(texture->get_image());
+					parsed.texture = texture;
 					continue;
 				}
 				// mimeType is optional, but if we have it in the file extension, let's use it.
@@ -3675,9 +3786,7 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 				data = FileAccess::get_file_as_bytes(uri);
 				if (data.size() == 0) {
 					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, mime_type, uri));
-					p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-					p_state->source_images.push_back(Ref<Image>());
-					continue;
+					continue; // Gets a placeholder below, to keep count.
 				}
 			}
 		} else if (dict.has("bufferView")) {
@@ -3696,15 +3805,47 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		// Note: There are paths above that return early, so this point might not be reached.
 		if (data.is_empty()) {
 			WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded, no data found. Skipping it.", i));
+			continue; // Gets a placeholder below, to keep count.
+		}
+		// Parse the image data from bytes into an Image resource. Extensions run here, on the
+		// calling thread, while the built-in PNG and JPEG decoding is deferred so it can be batched.
+		parsed.data = data;
+		parsed.mime_type = mime_type;
+		parsed.name = image_name;
+		parsed.image.instantiate();
+		if (!_parse_image_bytes_with_extensions(p_state, data, mime_type, i, parsed.image, parsed.file_extension)) {
+			parsed.needs_decode = true;
+			decode_count++;
+		}
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (decode_count > 1 && pool && WorkerThreadPool::get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_parse_image_decode_task, parsed_images.ptr(), parsed_images.size(), -1, true, String("GLTFDecodeImages"));
+		pool->wait_for_group_task_completion(group_task);
+	} else if (decode_count > 0) {
+		for (uint32_t i = 0; i < parsed_images.size(); i++) {
+			_parse_image_decode_task(parsed_images.ptr(), i);
+		}
+	}
+
+	// Save the images in their original order, since textures refer to them by index.
+	for (uint32_t i = 0; i < parsed_images.size(); i++) {
+		GLTFParsedImage &parsed = parsed_images[i];
+		if (!parsed.valid) {
+			continue;
+		}
+		if (parsed.texture.is_valid()) {
+			p_state->images.push_back(parsed.texture);
+			p_state->source_images.push_back(parsed.texture->get_image());
+		} else if (parsed.image.is_null()) {
 			p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 			p_state->source_images.push_back(Ref<Image>());
-			continue;
+		} else {
+			// Save the image if needed.
+			parsed.image->set_name(parsed.name);
+			_parse_image_save_image(p_state, parsed.data, parsed.file_extension, i, parsed.image);
 		}
-		// Parse the image data from bytes into an Image resource and save if needed.
-		String file_extension;
-		Ref<Image> img = _parse_image_bytes_into_image(p_state, data, mime_type, i, file_extension);
-		img->set_name(image_name);
-		_parse_image_save_image(p_state, data, file_extension, i, img);
 	}
 
 	print_verbose("glTF: Total images: " + itos(p_state->images.size()));
@@ -7144,7 +7285,11 @@ HashSet<String> GLTFDocument::get_supported_gltf_extensions_hashset() {
 	supported_extensions.insert("KHR_materials_emissive_strength");
 	supported_extensions.insert("KHR_materials_pbrSpecularGlossiness");
 	supported_extensions.insert("KHR_materials_unlit");
+	supported_extensions.insert("KHR_mesh_quantization");
 	supported_extensions.insert("KHR_texture_transform");
+	if (SurfaceTool::decode_vertex_buffer_func) {
+		supported_extensions.insert("EXT_meshopt_compression");
+	}
 	for (Ref<GLTFDocumentExtension> ext : all_document_extensions) {
 		ERR_CONTINUE(ext.is_null());
 		Vector<String> ext_supported_extensions = ext->get_supported_extensions();
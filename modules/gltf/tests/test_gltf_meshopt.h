@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_gltf_meshopt.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GLTF_MESHOPT_H
+#define TEST_GLTF_MESHOPT_H
+
+#include "tests/test_macros.h"
+
+#ifdef MODULE_MESHOPTIMIZER_ENABLED
+
+#include "core/crypto/crypto_core.h"
+#include "modules/gltf/gltf_document.h"
+#include "modules/gltf/gltf_state.h"
+
+#include "thirdparty/meshoptimizer/meshoptimizer.h"
+
+namespace TestGltfMeshopt {
+
+// Builds a glTF with a single EXT_meshopt_compression buffer view and loads it.
+static Error _load_meshopt_gltf(const Vector<uint8_t> &p_compressed, int64_t p_stride, int64_t p_count, const String &p_mode, const String &p_filter, Ref<GLTFState> &r_state) {
+	const String compressed = CryptoCore::b64_encode_str(p_compressed.ptr(), p_compressed.size());
+	const String json = vformat(R"({
+	"asset": { "version": "2.0" },
+	"extensionsUsed": [ "EXT_meshopt_compression" ],
+	"scene": 0,
+	"scenes": [ { "nodes": [ 0 ] } ],
+	"nodes": [ { "name": "Root" } ],
+	"buffers": [
+		{ "byteLength": %d, "uri": "data:application/octet-stream;base64,%s" },
+		{ "byteLength": %d, "extensions": { "EXT_meshopt_compression": { "fallback": true } } }
+	],
+	"bufferViews": [ {
+		"buffer": 1, "byteLength": %d, "byteStride": %d,
+		"extensions": { "EXT_meshopt_compression": {
+			"buffer": 0, "byteLength": %d, "byteStride": %d, "count": %d, "mode": "%s", "filter": "%s"
+		} }
+	} ]
+})",
+			p_compressed.size(), compressed, p_stride * p_count, p_stride * p_count, p_stride, p_compressed.size(), p_stride, p_count, p_mode, p_filter);
+
+	r_state.instantiate();
+	Ref<GLTFDocument> doc;
+	doc.instantiate();
+	return doc->append_from_buffer(json.to_utf8_buffer(), "", r_state);
+}
+
+static Vector<uint8_t> _encode_vertices(const Vector<uint8_t> &p_vertices, int64_t p_stride) {
+	const size_t count = p_vertices.size() / p_stride;
+	Vector<uint8_t> compressed;
+	compressed.resize(meshopt_encodeVertexBufferBound(count, p_stride));
+	const size_t size = meshopt_encodeVertexBuffer(compressed.ptrw(), compressed.size(), p_vertices.ptr(), count, p_stride);
+	compressed.resize(size);
+	return compressed;
+}
+
+static Vector<uint8_t> _make_vertices(int64_t p_stride, int64_t p_count) {
+	Vector<uint8_t> vertices;
+	vertices.resize(p_stride * p_count);
+	for (int i = 0; i < vertices.size(); i++) {
+		vertices.write[i] = uint8_t(i * 7);
+	}
+	return vertices;
+}
+
+TEST_CASE("[glTF][EXT_meshopt_compression] Decodes attribute buffer views") {
+	const Vector<uint8_t> vertices = _make_vertices(8, 16);
+	Ref<GLTFState> state;
+	REQUIRE(_load_meshopt_gltf(_encode_vertices(vertices, 8), 8, 16, "ATTRIBUTES", "NONE", state) == OK);
+
+	TypedArray<GLTFBufferView> buffer_views = state->get_buffer_views();
+	REQUIRE(buffer_views.size() == 1);
+	Ref<GLTFBufferView> buffer_view = buffer_views[0];
+	CHECK(buffer_view->get_byte_offset() == 0);
+	CHECK(buffer_view->get_byte_length() == vertices.size());
+
+	TypedArray<PackedByteArray> buffers = state->get_buffers();
+	REQUIRE(buffer_view->get_buffer() < buffers.size());
+	CHECK_MESSAGE(PackedByteArray(buffers[buffer_view->get_buffer()]) == vertices, "The decoded data should match the original vertices.");
+}
+
+TEST_CASE("[glTF][EXT_meshopt_compression] Accepts valid filter strides") {
+	Ref<GLTFState> state;
+	CHECK(_load_meshopt_gltf(_encode_vertices(_make_vertices(4, 16), 4), 4, 16, "ATTRIBUTES", "OCTAHEDRAL", state) == OK);
+	CHECK(_load_meshopt_gltf(_encode_vertices(_make_vertices(8, 16), 8), 8, 16, "ATTRIBUTES", "OCTAHEDRAL", state) == OK);
+	CHECK(_load_meshopt_gltf(_encode_vertices(_make_vertices(8, 16), 8), 8, 16, "ATTRIBUTES", "QUATERNION", state) == OK);
+	CHECK(_load_meshopt_gltf(_encode_vertices(_make_vertices(12, 16), 12), 12, 16, "ATTRIBUTES", "EXPONENTIAL", state) == OK);
+}
+
+TEST_CASE("[glTF][EXT_meshopt_compression] Rejects invalid filter and stride combinations") {
+	const Vector<uint8_t> compressed = _encode_vertices(_make_vertices(4, 16), 4);
+	Ref<GLTFState> state;
+
+	ERR_PRINT_OFF;
+	// Would decode count * 8 bytes into a count * 4 buffer.
+	CHECK(_load_meshopt_gltf(compressed, 4, 16, "ATTRIBUTES", "QUATERNION", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 12, 16, "ATTRIBUTES", "OCTAHEDRAL", state) != OK);
+	// Filters only apply to attributes.
+	CHECK(_load_meshopt_gltf(compressed, 2, 18, "TRIANGLES", "OCTAHEDRAL", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 2, 16, "INDICES", "QUATERNION", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 4, 16, "INDICES", "EXPONENTIAL", state) != OK);
+	// Invalid strides, modes and filters.
+	CHECK(_load_meshopt_gltf(compressed, 6, 16, "ATTRIBUTES", "NONE", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 260, 16, "ATTRIBUTES", "NONE", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 8, 16, "TRIANGLES", "NONE", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 2, 16, "TRIANGLES", "NONE", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 4, 16, "STRIPS", "NONE", state) != OK);
+	CHECK(_load_meshopt_gltf(compressed, 4, 16, "ATTRIBUTES", "SPHERICAL", state) != OK);
+	// Too large to allocate, regardless of the compressed data.
+	CHECK(_load_meshopt_gltf(compressed, 256, int64_t(1) << 40, "ATTRIBUTES", "NONE", state) != OK);
+	ERR_PRINT_ON;
+}
+
+} // namespace TestGltfMeshopt
+
+#endif // MODULE_MESHOPTIMIZER_ENABLED
+
+#endif // TEST_GLTF_MESHOPT_H
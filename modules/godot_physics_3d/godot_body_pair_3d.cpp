@@ -37,6 +37,9 @@
 
 #define MIN_VELOCITY 0.0001
 #define MAX_BIAS_ROTATION (Math_PI / 8)
+// Fraction of the contact recycle radius a shape may drift before its cached contacts are recomputed.
+#define CONTACT_CACHE_LINEAR_TOLERANCE 0.1
+#define CONTACT_CACHE_ANGULAR_TOLERANCE 0.0001
 
 void GodotBodyPair3D::_contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
 	GodotBodyPair3D *pair = static_cast<GodotBodyPair3D *>(p_userdata);
@@ -161,6 +164,34 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
+bool GodotBodyPair3D::_can_reuse_contacts(const Transform3D &p_xform_A, const Transform3D &p_xform_B, const GodotShape3D *p_shape_A, const GodotShape3D *p_shape_B) const {
+	if (contact_count == 0 || contact_count != cached_contact_count) {
+		// Nothing to reuse, or some contacts were just invalidated.
+		return false;
+	}
+
+	if (p_shape_A->get_aabb() != cached_aabb_A || p_shape_B->get_aabb() != cached_aabb_B) {
+		// Shape data was changed.
+		return false;
+	}
+
+	real_t linear_tolerance = space->get_contact_recycle_radius() * CONTACT_CACHE_LINEAR_TOLERANCE;
+	real_t linear_tolerance2 = linear_tolerance * linear_tolerance;
+	if (p_xform_A.origin.distance_squared_to(cached_xform_A.origin) > linear_tolerance2 ||
+			p_xform_B.origin.distance_squared_to(cached_xform_B.origin) > linear_tolerance2) {
+		return false;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		if (p_xform_A.basis.rows[i].distance_squared_to(cached_xform_A.basis.rows[i]) > CONTACT_CACHE_ANGULAR_TOLERANCE * CONTACT_CACHE_ANGULAR_TOLERANCE ||
+				p_xform_B.basis.rows[i].distance_squared_to(cached_xform_B.basis.rows[i]) > CONTACT_CACHE_ANGULAR_TOLERANCE * CONTACT_CACHE_ANGULAR_TOLERANCE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 // `_test_ccd` prevents tunneling by slowing down a high velocity body that is about to collide so
 // that next frame it will be at an appropriate location to collide (i.e. slight overlap).
 // WARNING: The way velocity is adjusted down to cause a collision means the momentum will be
@@ -263,6 +294,9 @@ real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
 bool GodotBodyPair3D::setup(real_t p_step) {
 	check_ccd = false;
 
+	bool contact_cache_was_valid = contact_cache_valid;
+	contact_cache_valid = false;
+
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
 		collided = false;
 		return false;
@@ -285,6 +319,22 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	validate_contacts();
 
+	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
+	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
+
+	Transform3D global_xform_A = A->get_transform() * A->get_shape_transform(shape_A);
+	Transform3D global_xform_B = B->get_transform() * B->get_shape_transform(shape_B);
+
+	if (contact_cache_was_valid && _can_reuse_contacts(global_xform_A, global_xform_B, shape_A_ptr, shape_B_ptr)) {
+		// Neither shape moved noticeably since the last narrow phase, keep its contacts.
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].used = true;
+		}
+		contact_cache_valid = true;
+		collided = true;
+		return true;
+	}
+
 	const Vector3 &offset_A = A->get_transform().get_origin();
 	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
 	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
@@ -293,12 +343,16 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	xform_Bu.origin -= offset_A;
 	Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
 
-	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
-	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
-
 	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
 
-	if (!collided) {
+	if (collided) {
+		contact_cache_valid = true;
+		cached_contact_count = contact_count;
+		cached_xform_A = global_xform_A;
+		cached_xform_B = global_xform_B;
+		cached_aabb_A = shape_A_ptr->get_aabb();
+		cached_aabb_B = shape_B_ptr->get_aabb();
+	} else {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
 			check_ccd = true;
 			return true;
@@ -97,11 +97,20 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Shape state of the last narrow phase run, used to reuse its contacts while both shapes stay still.
+	bool contact_cache_valid = false;
+	int cached_contact_count = 0;
+	Transform3D cached_xform_A;
+	Transform3D cached_xform_B;
+	AABB cached_aabb_A;
+	AABB cached_aabb_B;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
 
 	void validate_contacts();
+	bool _can_reuse_contacts(const Transform3D &p_xform_A, const Transform3D &p_xform_B, const GodotShape3D *p_shape_A, const GodotShape3D *p_shape_B) const;
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
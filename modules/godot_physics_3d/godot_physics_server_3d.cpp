@@ -38,7 +38,9 @@
 #include "joints/godot_pin_joint_3d.h"
 #include "joints/godot_slider_joint_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -1626,6 +1628,12 @@ void GodotPhysicsServer3D::set_active(bool p_active) {
 
 void GodotPhysicsServer3D::init() {
 	stepper = memnew(GodotStep3D);
+	step_spaces_in_parallel = GLOBAL_GET("physics/3d/step_spaces_in_parallel");
+}
+
+void GodotPhysicsServer3D::_step_space(uint32_t p_index, void *p_userdata) {
+	// Islands are solved serially here, the parallelism comes from stepping the spaces themselves.
+	parallel_steppers[p_index]->step(parallel_spaces[p_index], parallel_step_delta, false);
 }
 
 void GodotPhysicsServer3D::step(real_t p_step) {
@@ -1635,11 +1643,28 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 
 	_update_shapes();
 
+	if (step_spaces_in_parallel && active_spaces.size() > 1) {
+		parallel_spaces.clear();
+		for (const GodotSpace3D *E : active_spaces) {
+			parallel_spaces.push_back(const_cast<GodotSpace3D *>(E));
+		}
+		while (parallel_steppers.size() < parallel_spaces.size()) {
+			parallel_steppers.push_back(memnew(GodotStep3D));
+		}
+		parallel_step_delta = p_step;
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsServer3D::_step_space, nullptr, parallel_spaces.size(), -1, true, SNAME("Physics3DStepSpaces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (const GodotSpace3D *E : active_spaces) {
+			stepper->step(const_cast<GodotSpace3D *>(E), p_step);
+		}
+	}
+
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
 	for (const GodotSpace3D *E : active_spaces) {
-		stepper->step(const_cast<GodotSpace3D *>(E), p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
@@ -1706,6 +1731,10 @@ void GodotPhysicsServer3D::end_sync() {
 
 void GodotPhysicsServer3D::finish() {
 	memdelete(stepper);
+	for (GodotStep3D *parallel_stepper : parallel_steppers) {
+		memdelete(parallel_stepper);
+	}
+	parallel_steppers.clear();
 }
 
 int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
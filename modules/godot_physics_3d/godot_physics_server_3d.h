@@ -56,6 +56,12 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	GodotStep3D *stepper = nullptr;
 	HashSet<const GodotSpace3D *> active_spaces;
 
+	bool step_spaces_in_parallel = false;
+	real_t parallel_step_delta = 0.0;
+	LocalVector<GodotStep3D *> parallel_steppers;
+	LocalVector<GodotSpace3D *> parallel_spaces;
+	void _step_space(uint32_t p_index, void *p_userdata = nullptr);
+
 	mutable RID_PtrOwner<GodotShape3D, true> shape_owner;
 	mutable RID_PtrOwner<GodotSpace3D, true> space_owner;
 	mutable RID_PtrOwner<GodotArea3D, true> area_owner;
@@ -34,9 +34,13 @@
 #include "godot_space_3d.h"
 
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 class GodotStep3D {
-	uint64_t _step = 1;
+	// Shared by all steppers, so island stamps stay unique when several spaces are stepped at once.
+	static SafeNumeric<uint64_t> step_counter;
+
+	uint64_t _step = 0;
 
 	int iterations = 0;
 	real_t delta = 0.0;
@@ -53,7 +57,7 @@ class GodotStep3D {
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
-	void step(GodotSpace3D *p_space, real_t p_delta);
+	void step(GodotSpace3D *p_space, real_t p_delta, bool p_multithreaded = true);
 	GodotStep3D();
 	~GodotStep3D();
 };
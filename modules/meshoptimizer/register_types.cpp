@@ -47,6 +47,12 @@ void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = meshopt_generateVertexRemap;
 	SurfaceTool::remap_vertex_func = meshopt_remapVertexBuffer;
 	SurfaceTool::remap_index_func = meshopt_remapIndexBuffer;
+	SurfaceTool::decode_vertex_buffer_func = meshopt_decodeVertexBuffer;
+	SurfaceTool::decode_index_buffer_func = meshopt_decodeIndexBuffer;
+	SurfaceTool::decode_index_sequence_func = meshopt_decodeIndexSequence;
+	SurfaceTool::decode_filter_oct_func = meshopt_decodeFilterOct;
+	SurfaceTool::decode_filter_quat_func = meshopt_decodeFilterQuat;
+	SurfaceTool::decode_filter_exp_func = meshopt_decodeFilterExp;
 }
 
 void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
@@ -61,4 +67,10 @@ void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = nullptr;
 	SurfaceTool::remap_vertex_func = nullptr;
 	SurfaceTool::remap_index_func = nullptr;
+	SurfaceTool::decode_vertex_buffer_func = nullptr;
+	SurfaceTool::decode_index_buffer_func = nullptr;
+	SurfaceTool::decode_index_sequence_func = nullptr;
+	SurfaceTool::decode_filter_oct_func = nullptr;
+	SurfaceTool::decode_filter_quat_func = nullptr;
+	SurfaceTool::decode_filter_exp_func = nullptr;
 }
@@ -30,6 +30,7 @@
 
 #include "godot_navigation_server_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/os/mutex.h"
 #include "scene/main/node.h"
 
@@ -1314,9 +1315,13 @@ void GodotNavigationServer3D::sync() {
 }
 
 void GodotNavigationServer3D::process(real_t p_delta_time) {
+	// Async path queries run between frames, so they must be done before maps change or get freed.
+	_finish_async_path_queries(true);
+
 	flush_queries();
 
 	if (!active) {
+		_start_async_path_queries();
 		return;
 	}
 
@@ -1365,15 +1370,23 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+
+	_start_async_path_queries();
 }
 
 void GodotNavigationServer3D::init() {
+	max_async_path_queries_per_frame = MAX(1, int(GLOBAL_GET("navigation/pathfinding/max_async_path_queries_per_frame")));
 #ifndef _3D_DISABLED
 	navmesh_generator_3d = memnew(NavMeshGenerator3D);
 #endif // _3D_DISABLED
 }
 
 void GodotNavigationServer3D::finish() {
+	_finish_async_path_queries(false);
+	{
+		MutexLock lock(async_path_queries_mutex);
+		async_path_queries_pending.clear();
+	}
 	flush_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
@@ -1385,17 +1398,21 @@ void GodotNavigationServer3D::finish() {
 }
 
 PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &p_parameters) const {
-	PathQueryResult r_query_result;
-
 	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_NULL_V(map, r_query_result);
+	ERR_FAIL_NULL_V(map, PathQueryResult());
+
+	return _query_path_on_map(map, p_parameters);
+}
+
+PathQueryResult GodotNavigationServer3D::_query_path_on_map(const NavMap *p_map, const PathQueryParameters &p_parameters) const {
+	PathQueryResult r_query_result;
 
 	// run the pathfinding
 
 	if (p_parameters.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR) {
 		// while postprocessing is still part of map.get_path() need to check and route it here for the correct "optimize" post-processing
 		if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					true,
@@ -1404,7 +1421,7 @@ PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
 		} else if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					false,
@@ -1466,6 +1483,87 @@ PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &
 	return r_query_result;
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	AsyncPathQuery query;
+	query.parameters = p_query_parameters->get_parameters();
+	query.result = p_query_result;
+	query.callback = p_callback;
+
+	MutexLock lock(async_path_queries_mutex);
+	async_path_queries_pending.push_back(query);
+}
+
+void GodotNavigationServer3D::_run_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries) {
+	AsyncPathQuery &query = p_queries[p_index];
+	if (query.map) {
+		query.query_result = _query_path_on_map(query.map, query.parameters);
+	}
+}
+
+void GodotNavigationServer3D::_start_async_path_queries() {
+	DEV_ASSERT(async_path_queries_group_id == WorkerThreadPool::INVALID_TASK_ID);
+
+	{
+		MutexLock lock(async_path_queries_mutex);
+		if (async_path_queries_pending.is_empty()) {
+			return;
+		}
+
+		// Queries beyond the frame budget wait for the next frames, in submission order.
+		const uint32_t pending_count = async_path_queries_pending.size();
+		const uint32_t count = MIN(pending_count, max_async_path_queries_per_frame);
+		async_path_queries_running.resize(count);
+		for (uint32_t i = 0; i < count; i++) {
+			async_path_queries_running[i] = async_path_queries_pending[i];
+		}
+		for (uint32_t i = count; i < pending_count; i++) {
+			async_path_queries_pending[i - count] = async_path_queries_pending[i];
+		}
+		async_path_queries_pending.resize(pending_count - count);
+	}
+
+	{
+		// Maps are looked up here, since they can't be created or freed on other threads meanwhile.
+		MutexLock lock(operations_mutex);
+		for (AsyncPathQuery &query : async_path_queries_running) {
+			query.map = map_owner.get_or_null(query.parameters.map);
+			ERR_CONTINUE_MSG(!query.map, "Async path query on an invalid navigation map.");
+		}
+	}
+
+	async_path_queries_group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_run_async_path_query, async_path_queries_running.ptr(), async_path_queries_running.size(), -1, false, String("NavigationAsyncPathQueries"));
+}
+
+void GodotNavigationServer3D::_finish_async_path_queries(bool p_call_callbacks) {
+	if (async_path_queries_group_id == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(async_path_queries_group_id);
+	async_path_queries_group_id = WorkerThreadPool::INVALID_TASK_ID;
+
+	// Callbacks may queue new queries, so only keep the finished ones locally.
+	LocalVector<AsyncPathQuery> finished = async_path_queries_running;
+	async_path_queries_running.clear();
+
+	if (!p_call_callbacks) {
+		return;
+	}
+
+	for (AsyncPathQuery &query : finished) {
+		query.result->set_path(query.query_result.path);
+		query.result->set_path_types(query.query_result.path_types);
+		query.result->set_path_rids(query.query_result.path_rids);
+		query.result->set_path_owner_ids(query.query_result.path_owner_ids);
+		if (query.callback.is_valid()) {
+			query.callback.call(query.result);
+		}
+	}
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
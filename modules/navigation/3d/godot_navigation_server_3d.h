@@ -37,6 +37,7 @@
 #include "../nav_obstacle.h"
 #include "../nav_region.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "core/templates/rid_owner.h"
@@ -86,6 +87,21 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 #endif // _3D_DISABLED
 
+	struct AsyncPathQuery {
+		NavigationUtilities::PathQueryParameters parameters;
+		Ref<NavigationPathQueryResult3D> result;
+		Callable callback;
+		const NavMap *map = nullptr;
+		NavigationUtilities::PathQueryResult query_result;
+	};
+
+	Mutex async_path_queries_mutex;
+	LocalVector<AsyncPathQuery> async_path_queries_pending;
+	// Only accessed by process(), and by the worker threads while the group task runs.
+	LocalVector<AsyncPathQuery> async_path_queries_running;
+	WorkerThreadPool::GroupID async_path_queries_group_id = WorkerThreadPool::INVALID_TASK_ID;
+	uint32_t max_async_path_queries_per_frame = 256;
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -289,12 +305,18 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
+
+	NavigationUtilities::PathQueryResult _query_path_on_map(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) const;
+	void _run_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries);
+	void _start_async_path_queries();
+	void _finish_async_path_queries(bool p_call_callbacks);
 };
 
 #undef COMMAND_1
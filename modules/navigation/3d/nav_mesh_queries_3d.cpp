@@ -127,6 +127,18 @@ Vector3 NavMeshQueries3D::polygons_get_random_point(const LocalVector<gd::Polygo
 	}
 }
 
+static uint32_t _next_search_generation(LocalVector<gd::NavigationPoly> &r_navigation_polys, uint32_t p_generation) {
+	p_generation++;
+	if (unlikely(p_generation == 0)) {
+		// Wrapped around, clear all stamps so none can match by accident.
+		for (gd::NavigationPoly &nav_poly : r_navigation_polys) {
+			nav_poly.search_generation = 0;
+		}
+		p_generation = 1;
+	}
+	return p_generation;
+}
+
 Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygon> &p_polygons, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, const Vector3 &p_map_up, uint32_t p_link_polygons_size) {
 	// Clear metadata outputs.
 	if (r_path_types) {
@@ -205,22 +217,33 @@ Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygo
 		return path;
 	}
 
+	// The search state below is kept per thread, so that repeated queries reuse its memory.
+	// Entries are stamped with the search that touched them, so only the visited ones are ever reset.
+
+	// Heap of polygons to travel next.
+	static thread_local gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer>
+			traversable_polys;
+	// Must happen before navigation_polys is touched, as it writes back into the polys of the last query.
+	traversable_polys.clear();
+	traversable_polys.reserve(p_polygons.size() * 0.25);
+
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.resize(p_polygons.size() + p_link_polygons_size);
+	static thread_local LocalVector<gd::NavigationPoly> navigation_polys;
+	static thread_local uint32_t search_generation = 0;
+	if (navigation_polys.size() < p_polygons.size() + p_link_polygons_size) {
+		navigation_polys.resize(p_polygons.size() + p_link_polygons_size);
+	}
+	search_generation = _next_search_generation(navigation_polys, search_generation);
 
 	// Initialize the matching navigation polygon.
 	gd::NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
+	begin_navigation_poly = gd::NavigationPoly();
+	begin_navigation_poly.search_generation = search_generation;
 	begin_navigation_poly.poly = begin_poly;
 	begin_navigation_poly.entry = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 
-	// Heap of polygons to travel next.
-	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer>
-			traversable_polys;
-	traversable_polys.reserve(p_polygons.size() * 0.25);
-
 	// This is an implementation of the A* algorithm.
 	int least_cost_id = begin_poly->id;
 	int prev_least_cost_id = -1;
@@ -257,6 +280,11 @@ Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygo
 
 				// Check if the neighbor polygon has already been processed.
 				gd::NavigationPoly &neighbor_poly = navigation_polys[connection.polygon->id];
+				if (neighbor_poly.search_generation != search_generation) {
+					// Left over from an earlier search, so not processed by this one.
+					neighbor_poly = gd::NavigationPoly();
+					neighbor_poly.search_generation = search_generation;
+				}
 				if (neighbor_poly.poly != nullptr) {
 					// If the neighbor polygon hasn't been traversed yet and the new path leading to
 					// it is shorter, update the polygon.
@@ -358,9 +386,8 @@ Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygo
 				return path;
 			}
 
-			for (gd::NavigationPoly &nav_poly : navigation_polys) {
-				nav_poly.poly = nullptr;
-			}
+			search_generation = _next_search_generation(navigation_polys, search_generation);
+			navigation_polys[begin_poly->id].search_generation = search_generation;
 			navigation_polys[begin_poly->id].poly = begin_poly;
 
 			least_cost_id = begin_poly->id;
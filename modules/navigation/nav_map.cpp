@@ -792,18 +792,24 @@ void NavMap::_update_rvo_simulation() {
 	}
 }
 
-void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
+void NavMap::compute_avoidance_step_range_2d(uint32_t p_begin, uint32_t p_end, NavAgent **p_agents) {
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		NavAgent *agent = p_agents[i];
+		agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+		agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
+		agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+		agent->update();
+	}
 }
 
-void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
+void NavMap::compute_avoidance_step_range_3d(uint32_t p_begin, uint32_t p_end, NavAgent **p_agents) {
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		NavAgent *agent = p_agents[i];
+		agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+		agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
+		agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+		agent->update();
+	}
 }
 
 void NavMap::step(real_t p_deltatime) {
@@ -814,7 +820,7 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_step_range_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), AVOIDANCE_AGENTS_GRAIN_SIZE, true, -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_2d_avoidance_agents) {
@@ -828,7 +834,7 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_3d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_step_range_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), AVOIDANCE_AGENTS_GRAIN_SIZE, true, -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_3d_avoidance_agents) {
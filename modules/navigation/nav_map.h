@@ -229,8 +229,10 @@ public:
 private:
 	void compute_single_step(uint32_t index, NavAgent **agent);
 
-	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
-	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
+	// Agents are processed in ranges to avoid paying the task dispatch cost for each one of them.
+	static const int AVOIDANCE_AGENTS_GRAIN_SIZE = 16;
+	void compute_avoidance_step_range_2d(uint32_t p_begin, uint32_t p_end, NavAgent **p_agents);
+	void compute_avoidance_step_range_3d(uint32_t p_begin, uint32_t p_end, NavAgent **p_agents);
 
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
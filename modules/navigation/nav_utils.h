@@ -120,6 +120,9 @@ struct NavigationPoly {
 	/// Index in the heap of traversable polygons.
 	uint32_t traversable_poly_index = UINT32_MAX;
 
+	/// The path search that last touched this poly, older values mean the rest of the data is stale.
+	uint32_t search_generation = 0;
+
 	/// Those 4 variables are used to travel the path backwards.
 	int back_navigation_poly_id = -1;
 	int back_navigation_edge = -1;
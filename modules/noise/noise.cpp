@@ -30,6 +30,8 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include <float.h>
 
 Vector<Ref<Image>> Noise::_get_seamless_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt, bool p_normalize) const {
@@ -80,35 +82,78 @@ uint8_t Noise::_alpha_blend<uint8_t>(uint8_t p_bg, uint8_t p_fg, int p_alpha) co
 	return (uint8_t)((alpha * p_fg + inv_alpha * p_bg) >> 8);
 }
 
+// Images with fewer samples than this are generated on the calling thread,
+// larger ones are split into bands of rows across the WorkerThreadPool.
+#define NOISE_IMAGE_PARALLEL_MIN_SAMPLES (128 * 128)
+#define NOISE_IMAGE_ROWS_GRAIN_SIZE 8
+
+struct NoiseImageRowsData {
+	const Noise *noise = nullptr;
+	real_t *values = nullptr;
+	int width = 0;
+	int height = 0;
+	bool in_3d_space = false;
+};
+
+static void _get_noise_rows(void *p_userdata, uint32_t p_begin, uint32_t p_end) {
+	const NoiseImageRowsData *rd = (const NoiseImageRowsData *)p_userdata;
+	for (uint32_t row = p_begin; row < p_end; row++) {
+		// Rows are counted across all layers.
+		int y = row % rd->height;
+		int d = row / rd->height;
+		real_t *w = rd->values + (uint64_t)row * rd->width;
+		if (rd->in_3d_space) {
+			for (int x = 0; x < rd->width; x++) {
+				w[x] = rd->noise->get_noise_3d(x, y, d);
+			}
+		} else {
+			for (int x = 0; x < rd->width; x++) {
+				w[x] = rd->noise->get_noise_2d(x, y);
+			}
+		}
+	}
+}
+
 Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
 	Vector<Ref<Image>> images;
 	images.resize(p_depth);
 
-	if (p_normalize) {
-		// Get all values and identify min/max values.
-		LocalVector<real_t> values;
-		values.resize(p_width * p_height * p_depth);
+	// Get all values first, noise functions are const so rows can be sampled in parallel.
+	LocalVector<real_t> values;
+	values.resize(p_width * p_height * p_depth);
+
+	NoiseImageRowsData rd;
+	rd.noise = this;
+	rd.values = values.ptr();
+	rd.width = p_width;
+	rd.height = p_height;
+	rd.in_3d_space = p_in_3d_space;
+
+	const uint32_t rows = p_height * p_depth;
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Don't block a pool thread waiting on nested work, it could starve the pool.
+	if (values.size() < NOISE_IMAGE_PARALLEL_MIN_SAMPLES || !pool || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+		_get_noise_rows(&rd, 0, rows);
+	} else {
+		WorkerThreadPool::GroupID group_task = pool->add_native_range_group_task(&_get_noise_rows, &rd, rows, NOISE_IMAGE_ROWS_GRAIN_SIZE, false, -1, true, String("NoiseImage"));
+		pool->wait_for_group_task_completion(group_task);
+	}
 
+	if (p_normalize) {
+		// Identify min/max values.
 		real_t min_val = FLT_MAX;
 		real_t max_val = -FLT_MAX;
-		int idx = 0;
-		for (int d = 0; d < p_depth; d++) {
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					values[idx] = p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y);
-					if (values[idx] > max_val) {
-						max_val = values[idx];
-					}
-					if (values[idx] < min_val) {
-						min_val = values[idx];
-					}
-					idx++;
-				}
+		for (uint32_t i = 0; i < values.size(); i++) {
+			if (values[i] > max_val) {
+				max_val = values[i];
+			}
+			if (values[i] < min_val) {
+				min_val = values[i];
 			}
 		}
-		idx = 0;
+		int idx = 0;
 		// Normalize values and write to texture.
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -138,7 +183,7 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 		}
 	} else {
 		// Without normalization, the expected range of the noise function is [-1, 1].
-
+		int idx = 0;
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
 			data.resize(p_width * p_height);
@@ -146,14 +191,11 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 			uint8_t *wd8 = data.ptrw();
 
 			uint8_t ivalue;
-			int idx = 0;
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					float value = (p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y));
-					ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
-					wd8[idx] = p_invert ? (255 - ivalue) : ivalue;
-					idx++;
-				}
+			for (int i = 0; i < p_width * p_height; i++) {
+				float value = values[idx];
+				ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
+				wd8[i] = p_invert ? (255 - ivalue) : ivalue;
+				idx++;
 			}
 
 			Ref<Image> img = memnew(Image(p_width, p_height, false, Image::FORMAT_L8, data));
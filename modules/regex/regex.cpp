@@ -162,6 +162,16 @@ void RegEx::_pattern_info(uint32_t what, void *where) const {
 	pcre2_pattern_info_32((pcre2_code_32 *)code, what, where);
 }
 
+// JIT matching runs on a small machine stack by default, which backtracking-heavy patterns on long
+// subjects can overflow. The interpreter keeps its backtracking frames on the heap, so retry with it.
+static int _regex_match(const pcre2_code_32 *p_code, PCRE2_SPTR32 p_subject, PCRE2_SIZE p_length, PCRE2_SIZE p_offset, pcre2_match_data_32 *p_match, pcre2_match_context_32 *p_mctx) {
+	int res = pcre2_match_32(p_code, p_subject, p_length, p_offset, 0, p_match, p_mctx);
+	if (unlikely(res == PCRE2_ERROR_JIT_STACKLIMIT)) {
+		res = pcre2_match_32(p_code, p_subject, p_length, p_offset, PCRE2_NO_JIT, p_match, p_mctx);
+	}
+	return res;
+}
+
 Ref<RegEx> RegEx::create_from_string(const String &p_pattern, bool p_show_error) {
 	Ref<RegEx> ret;
 	ret.instantiate();
@@ -201,6 +211,11 @@ Error RegEx::compile(const String &p_pattern, bool p_show_error) {
 		}
 		return FAILED;
 	}
+
+	// Matching uses the JIT-compiled code automatically when available. If PCRE2 was built
+	// without JIT support, or JIT compilation fails, the interpreter is used as before.
+	pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE);
+
 	return OK;
 }
 
@@ -222,7 +237,7 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 
 	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	int res = _regex_match(c, s, length, p_offset, match, mctx);
 
 	if (res < 0) {
 		pcre2_match_data_free_32(match);
@@ -289,6 +304,44 @@ TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset,
 	return result;
 }
 
+PackedInt32Array RegEx::search_all_offsets(const String &p_subject, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), PackedInt32Array());
+	ERR_FAIL_COND_V_MSG(p_offset < 0, PackedInt32Array(), "RegEx search offset must be >= 0");
+
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
+	}
+
+	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
+
+	// Match data is reused for every result, unlike search_all() no RegExMatch is created.
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+
+	PackedInt32Array result;
+	int offset = p_offset;
+	while (_regex_match(c, s, length, offset, match, mctx) >= 0) {
+		int start = ovector[0];
+		int end = ovector[1];
+		result.push_back(start);
+		result.push_back(end);
+
+		offset = end;
+		if (start == end) {
+			offset++;
+		}
+	}
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
+	return result;
+}
+
 String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_all, int p_offset, int p_end) const {
 	ERR_FAIL_COND_V(!is_valid(), String());
 	ERR_FAIL_COND_V_MSG(p_offset < 0, String(), "RegEx sub offset must be >= 0");
@@ -324,6 +377,12 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 
 	int res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
 
+	if (res == PCRE2_ERROR_JIT_STACKLIMIT) {
+		// See _regex_match().
+		flags |= PCRE2_NO_JIT;
+		res = pcre2_substitute_32(c, s, length, p_offset, flags, match, mctx, r, p_replacement.length(), o, &olength);
+	}
+
 	if (res == PCRE2_ERROR_NOMEMORY) {
 		output.resize(olength + safety_zone);
 		o = (PCRE2_UCHAR32 *)output.ptrw();
@@ -404,6 +463,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern", "show_error"), &RegEx::compile, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_offsets", "subject", "offset", "end"), &RegEx::search_all_offsets, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
@@ -103,10 +103,18 @@ TEST_CASE("[RegEx] Searching") {
 	REQUIRE(match.is_valid());
 	CHECK(match->get_string(0) == "i");
 
+	const PackedInt32Array all_offsets = re.search_all_offsets(s);
+	REQUIRE(all_offsets.size() == 4);
+	CHECK(all_offsets[0] == 1);
+	CHECK(all_offsets[1] == 3);
+	CHECK(all_offsets[2] == 6);
+	CHECK(all_offsets[3] == 7);
+
 	CHECK(re.compile(numerics) == OK);
 	CHECK(re.is_valid());
 	CHECK(re.search(s).is_null());
 	CHECK(re.search_all(s).size() == 0);
+	CHECK(re.search_all_offsets(s).size() == 0);
 }
 
 TEST_CASE("[RegEx] Substitution") {
@@ -413,6 +421,28 @@ TEST_CASE("[RegEx] Lookbehind groups empty matches") {
 	CHECK(match->get_string(1) == String("b"));
 }
 
+TEST_CASE("[RegEx] Long subject with backtracking") {
+	// Each repetition of the capturing group is a backtracking point, enough to overflow the default JIT stack.
+	String subject;
+	for (int i = 0; i < 50000; i++) {
+		subject += "ab";
+	}
+	subject += "c";
+
+	RegEx re("(a|b)*c");
+	REQUIRE(re.is_valid());
+
+	Ref<RegExMatch> match = re.search(subject);
+	REQUIRE(match.is_valid());
+	CHECK(match->get_start(0) == 0);
+	CHECK(match->get_end(0) == subject.length());
+	CHECK(match->get_string(1) == String("b"));
+
+	CHECK(re.search_all(subject).size() == 1);
+	CHECK(re.search_all_offsets(subject) == PackedInt32Array({ 0, subject.length() }));
+	CHECK(re.sub(subject, "x") == String("x"));
+}
+
 } // namespace TestRegEx
 
 #endif // TEST_REGEX_H
@@ -30,10 +30,45 @@
 
 #include "register_types.h"
 
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 #include "scene/resources/mesh.h"
 
 #include "thirdparty/vhacd/public/VHACD.h"
 
+// Decompositions are cached by a hash of the input geometry and parameters, so
+// reimporting a scene only decomposes the meshes that actually changed.
+#define CONVEX_DECOMPOSITION_CACHE_MAX_ENTRIES 1024
+
+struct ConvexDecompositionCacheEntry {
+	Vector<Vector<Vector3>> hulls;
+	Vector<Vector<uint32_t>> indices;
+};
+
+static Mutex convex_decomposition_cache_mutex;
+static HashMap<uint64_t, ConvexDecompositionCacheEntry> convex_decomposition_cache;
+
+static uint32_t _hash_decomposition_input(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const VHACD::IVHACD::Parameters &p_params, uint32_t p_seed) {
+	uint32_t h = hash_murmur3_one_double(p_params.m_concavity, p_seed);
+	h = hash_murmur3_one_double(p_params.m_alpha, h);
+	h = hash_murmur3_one_double(p_params.m_beta, h);
+	h = hash_murmur3_one_double(p_params.m_minVolumePerCH, h);
+	h = hash_murmur3_one_32(p_params.m_resolution, h);
+	h = hash_murmur3_one_32(p_params.m_maxNumVerticesPerCH, h);
+	h = hash_murmur3_one_32(p_params.m_planeDownsampling, h);
+	h = hash_murmur3_one_32(p_params.m_convexhullDownsampling, h);
+	h = hash_murmur3_one_32(p_params.m_pca, h);
+	h = hash_murmur3_one_32(p_params.m_mode, h);
+	h = hash_murmur3_one_32(p_params.m_convexhullApproximation, h);
+	h = hash_murmur3_one_32(p_params.m_maxConvexHulls, h);
+	h = hash_murmur3_one_32(p_params.m_projectHullVertices, h);
+	h = hash_murmur3_one_32(p_vertex_count, h);
+	h = hash_murmur3_one_32(p_triangle_count, h);
+	h = hash_murmur3_buffer(p_vertices, p_vertex_count * 3 * sizeof(real_t), h);
+	h = hash_murmur3_buffer(p_triangles, p_triangle_count * 3 * sizeof(uint32_t), h);
+	return hash_fmix32(h);
+}
+
 static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_vertex_count, const uint32_t *p_triangles, int p_triangle_count, const Ref<MeshConvexDecompositionSettings> &p_settings, Vector<Vector<uint32_t>> *r_convex_indices) {
 	VHACD::IVHACD::Parameters params;
 	params.m_concavity = p_settings->get_max_concavity();
@@ -51,6 +86,19 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 	params.m_maxConvexHulls = p_settings->get_max_convex_hulls();
 	params.m_projectHullVertices = p_settings->get_project_hull_vertices();
 
+	// Two differently seeded 32-bit hashes make accidental collisions negligible.
+	const uint64_t key = (uint64_t(_hash_decomposition_input(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params, HASH_MURMUR3_SEED)) << 32) | _hash_decomposition_input(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params, ~HASH_MURMUR3_SEED);
+	{
+		MutexLock lock(convex_decomposition_cache_mutex);
+		const ConvexDecompositionCacheEntry *cached = convex_decomposition_cache.getptr(key);
+		if (cached) {
+			if (r_convex_indices) {
+				*r_convex_indices = cached->indices;
+			}
+			return cached->hulls;
+		}
+	}
+
 	VHACD::IVHACD *decomposer = VHACD::CreateVHACD();
 	decomposer->Compute(p_vertices, p_vertex_count, p_triangles, p_triangle_count, params);
 
@@ -59,9 +107,9 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 	Vector<Vector<Vector3>> ret;
 	ret.resize(hull_count);
 
-	if (r_convex_indices) {
-		r_convex_indices->resize(hull_count);
-	}
+	// Indices are always gathered so cached entries can serve either kind of request.
+	Vector<Vector<uint32_t>> convex_indices;
+	convex_indices.resize(hull_count);
 
 	for (int i = 0; i < hull_count; i++) {
 		VHACD::IVHACD::ConvexHull hull;
@@ -77,17 +125,29 @@ static Vector<Vector<Vector3>> convex_decompose(const real_t *p_vertices, int p_
 			}
 		}
 
-		if (r_convex_indices) {
-			Vector<uint32_t> &indices = r_convex_indices->write[i];
-			indices.resize(hull.m_nTriangles * 3);
+		Vector<uint32_t> &indices = convex_indices.write[i];
+		indices.resize(hull.m_nTriangles * 3);
 
-			memcpy(indices.ptrw(), hull.m_triangles, hull.m_nTriangles * 3 * sizeof(uint32_t));
-		}
+		memcpy(indices.ptrw(), hull.m_triangles, hull.m_nTriangles * 3 * sizeof(uint32_t));
 	}
 
 	decomposer->Clean();
 	decomposer->Release();
 
+	{
+		MutexLock lock(convex_decomposition_cache_mutex);
+		if (convex_decomposition_cache.size() >= CONVEX_DECOMPOSITION_CACHE_MAX_ENTRIES) {
+			convex_decomposition_cache.clear();
+		}
+		ConvexDecompositionCacheEntry &entry = convex_decomposition_cache[key];
+		entry.hulls = ret;
+		entry.indices = convex_indices;
+	}
+
+	if (r_convex_indices) {
+		*r_convex_indices = convex_indices;
+	}
+
 	return ret;
 }
 
@@ -105,4 +165,7 @@ void uninitialize_vhacd_module(ModuleInitializationLevel p_level) {
 	}
 
 	Mesh::convex_decomposition_function = nullptr;
+
+	MutexLock lock(convex_decomposition_cache_mutex);
+	convex_decomposition_cache.clear();
 }
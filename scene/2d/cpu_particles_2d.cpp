@@ -30,12 +30,16 @@
 
 #include "cpu_particles_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/curve_texture.h"
 #include "scene/resources/gradient_texture.h"
 #include "scene/resources/particle_process_material.h"
 
+// Particles written per task when filling the instance buffer.
+#define CPU_PARTICLES_DATA_GRAIN_SIZE 256
+
 void CPUParticles2D::set_emitting(bool p_emitting) {
 	if (emitting == p_emitting) {
 		return;
@@ -1010,7 +1014,6 @@ void CPUParticles2D::_update_particle_data_buffer() {
 
 	float *w = particle_data.ptrw();
 	const Particle *r = particles.ptr();
-	float *ptr = w;
 
 	if (draw_order != DRAW_ORDER_INDEX) {
 		ow = particle_order.ptrw();
@@ -1026,8 +1029,26 @@ void CPUParticles2D::_update_particle_data_buffer() {
 		}
 	}
 
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
+	ParticleDataFill fill;
+	fill.order = order;
+	fill.data = w;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Don't block a pool thread waiting on nested work, it could starve the pool.
+	if (pc < CPU_PARTICLES_DATA_GRAIN_SIZE * 2 || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+		_fill_particle_data_range(0, pc, &fill);
+	} else {
+		WorkerThreadPool::GroupID group_task = pool->add_template_range_group_task(this, &CPUParticles2D::_fill_particle_data_range, (const ParticleDataFill *)&fill, pc, CPU_PARTICLES_DATA_GRAIN_SIZE, false, -1, true, String("CPUParticles2DFillData"));
+		pool->wait_for_group_task_completion(group_task);
+	}
+}
+
+void CPUParticles2D::_fill_particle_data_range(uint32_t p_begin, uint32_t p_end, const ParticleDataFill *p_fill) {
+	const Particle *r = particles.ptr();
+	float *ptr = p_fill->data + p_begin * 16;
+
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		int idx = p_fill->order ? p_fill->order[i] : i;
 
 		Transform2D t = r[idx].transform;
 
@@ -189,7 +189,13 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	struct ParticleDataFill {
+		const int *order = nullptr;
+		float *data = nullptr;
+	};
+
 	void _update_particle_data_buffer();
+	void _fill_particle_data_range(uint32_t p_begin, uint32_t p_end, const ParticleDataFill *p_fill);
 
 	Mutex update_mutex;
 
@@ -732,7 +732,7 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform3D &p_pose) {
 	bones.write[p_bone].pose_scale = p_pose.basis.get_scale();
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 
@@ -743,7 +743,7 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 	bones.write[p_bone].pose_position = p_position;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
@@ -753,7 +753,7 @@ void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation
 	bones.write[p_bone].pose_rotation = p_rotation;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
@@ -763,7 +763,7 @@ void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	bones.write[p_bone].pose_scale = p_scale;
 	bones.write[p_bone].pose_cache_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_make_bone_dirty(p_bone);
 	}
 }
 
@@ -807,6 +807,7 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	all_bones_dirty = true;
 	if (dirty) {
 		return;
 	}
@@ -814,6 +815,30 @@ void Skeleton3D::_make_dirty() {
 	_update_deferred();
 }
 
+void Skeleton3D::_make_bone_dirty(int p_bone) {
+	Bone &bone = bones.write[p_bone];
+	if (!all_bones_dirty && !bone.global_pose_dirty) {
+		bone.global_pose_dirty = true;
+		dirty_bones.push_back(p_bone);
+	}
+	if (dirty) {
+		return;
+	}
+	dirty = true;
+	_update_deferred();
+}
+
+void Skeleton3D::_clear_dirty_bones() {
+	const int bone_size = bones.size();
+	Bone *bonesptr = bones.ptrw();
+	for (int bone : dirty_bones) {
+		if (bone < bone_size) {
+			bonesptr[bone].global_pose_dirty = false;
+		}
+	}
+	dirty_bones.clear();
+}
+
 void Skeleton3D::_update_deferred(UpdateFlag p_update_flag) {
 	if (is_inside_tree()) {
 		if (update_flags == UPDATE_FLAG_NONE && !updating) {
@@ -917,11 +942,38 @@ void Skeleton3D::force_update_all_dirty_bones() {
 	if (!dirty) {
 		return;
 	}
-	force_update_all_bone_transforms();
+	if (all_bones_dirty || rest_dirty || process_order_dirty) {
+		force_update_all_bone_transforms();
+		return;
+	}
+
+	// Only poses changed, so recompute the subtrees of the changed bones. A bone with a changed
+	// ancestor is skipped, as the ancestor's pass already covers it.
+	const Bone *bonesptr = bones.ptr();
+	for (int bone : dirty_bones) {
+		bool ancestor_dirty = false;
+		for (int parent = bonesptr[bone].parent; parent >= 0; parent = bonesptr[parent].parent) {
+			if (bonesptr[parent].global_pose_dirty) {
+				ancestor_dirty = true;
+				break;
+			}
+		}
+		if (!ancestor_dirty) {
+			force_update_bone_children_transforms(bone);
+		}
+	}
+	_clear_dirty_bones();
+	dirty = false;
+	if (updating) {
+		return;
+	}
+	emit_signal(SceneStringName(pose_updated));
 }
 
 void Skeleton3D::force_update_all_bone_transforms() {
 	_update_process_order();
+	_clear_dirty_bones();
+	all_bones_dirty = false;
 	for (int i = 0; i < parentless_bones.size(); i++) {
 		force_update_bone_children_transforms(parentless_bones[i]);
 	}
@@ -988,6 +1040,10 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 			b.global_pose = b.global_pose.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
 		}
 		if (b.global_pose_override_reset) {
+			if (b.global_pose_override_amount >= CMP_EPSILON) {
+				// Bones outside the next changed subtrees would keep the override applied.
+				all_bones_dirty = true;
+			}
 			b.global_pose_override_amount = 0.0;
 		}
 #endif // _DISABLE_DEPRECATED
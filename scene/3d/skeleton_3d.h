@@ -102,6 +102,7 @@ private:
 
 		bool enabled = true;
 		bool pose_cache_dirty = true;
+		bool global_pose_dirty = false; // Queued in dirty_bones.
 		Transform3D pose_cache;
 		Vector3 pose_position;
 		Quaternion pose_rotation;
@@ -163,9 +164,15 @@ private:
 	void _update_bone_names() const;
 
 	void _make_dirty();
+	void _make_bone_dirty(int p_bone);
 	bool dirty = false;
 	bool rest_dirty = false;
 
+	// When only bone poses changed, just the subtrees of the bones in dirty_bones need new global poses.
+	bool all_bones_dirty = true;
+	LocalVector<int> dirty_bones;
+	void _clear_dirty_bones();
+
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
 
@@ -1613,6 +1613,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 		data.children_cache.push_back(p_child);
 	} else {
 		data.children_cache_dirty = true;
+		data.children_cache_has_holes = false;
 	}
 
 	p_child->notification(NOTIFICATION_PARENTED);
@@ -1690,6 +1691,28 @@ void Node::remove_child(Node *p_child) {
 
 	data.blocked--;
 
+	if (!data.children_cache_dirty || data.children_cache_has_holes) {
+		// The cache is still ordered, so blank the child's slot instead of forcing a full rebuild.
+		// Slots don't move until the cache is compacted, which keeps bulk removals O(1) each.
+		int cache_index = p_child->data.index;
+		switch (p_child->data.internal_mode) {
+			case INTERNAL_MODE_DISABLED: {
+				cache_index += data.internal_children_front_count_cache;
+			} break;
+			case INTERNAL_MODE_BACK: {
+				cache_index += data.internal_children_front_count_cache + data.external_children_count_cache;
+			} break;
+			case INTERNAL_MODE_FRONT: {
+			} break;
+		}
+
+		if (cache_index >= 0 && cache_index < (int)data.children_cache.size() && data.children_cache[cache_index] == p_child) {
+			data.children_cache[cache_index] = nullptr;
+			data.children_cache_has_holes = true;
+		} else {
+			data.children_cache_has_holes = false;
+		}
+	}
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
@@ -1706,15 +1729,27 @@ void Node::remove_child(Node *p_child) {
 }
 
 void Node::_update_children_cache_impl() const {
-	// Assign children
-	data.children_cache.resize(data.children.size());
-	int idx = 0;
-	for (const KeyValue<StringName, Node *> &K : data.children) {
-		data.children_cache[idx] = K.value;
-		idx++;
+	if (data.children_cache_has_holes) {
+		// Only removals happened, compact the remaining children in order.
+		uint32_t valid_count = 0;
+		for (uint32_t i = 0; i < data.children_cache.size(); i++) {
+			if (data.children_cache[i]) {
+				data.children_cache[valid_count++] = data.children_cache[i];
+			}
+		}
+		data.children_cache.resize(valid_count);
+		data.children_cache_has_holes = false;
+	} else {
+		// Assign children
+		data.children_cache.resize(data.children.size());
+		int idx = 0;
+		for (const KeyValue<StringName, Node *> &K : data.children) {
+			data.children_cache[idx] = K.value;
+			idx++;
+		}
+		// Sort them
+		data.children_cache.sort_custom<ComparatorByIndex>();
 	}
-	// Sort them
-	data.children_cache.sort_custom<ComparatorByIndex>();
 	// Update indices
 	data.external_children_count_cache = 0;
 	data.internal_children_back_count_cache = 0;
@@ -167,6 +167,8 @@ private:
 		Node *owner = nullptr;
 		HashMap<StringName, Node *> children;
 		mutable bool children_cache_dirty = true;
+		// When set, the cache is still ordered and only has null slots left by removed children.
+		mutable bool children_cache_has_holes = false;
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
@@ -288,7 +288,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read only, so the copy keeps sharing the group's buffer.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -352,7 +352,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read only, so the copy keeps sharing the group's buffer.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -414,7 +414,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read only, so the copy keeps sharing the group's buffer.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -1239,7 +1239,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read only, so the copy keeps sharing the group's buffer.
 
 	{
 		_THREAD_SAFE_METHOD_
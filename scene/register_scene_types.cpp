@@ -343,6 +343,9 @@ void register_scene_types() {
 
 	resource_loader_text.instantiate();
 	ResourceLoader::add_resource_format_loader(resource_loader_text, true);
+#ifdef TOOLS_ENABLED
+	ResourceFormatLoaderText::use_binary_cache = GLOBAL_DEF("editor/import/cache_text_resources_as_binary", false);
+#endif
 
 	resource_saver_shader.instantiate();
 	ResourceSaver::add_resource_format_saver(resource_saver_shader, true);
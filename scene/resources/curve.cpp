@@ -1899,6 +1899,55 @@ Vector3 Curve3D::sample_baked(real_t p_offset, bool p_cubic) const {
 	return _sample_baked(interval, p_cubic);
 }
 
+PackedVector3Array Curve3D::sample_baked_array(const PackedFloat32Array &p_offsets, bool p_cubic) const {
+	if (baked_cache_dirty) {
+		_bake();
+	}
+
+	PackedVector3Array ret;
+
+	// Validate: Curve may not have baked points.
+	int pc = baked_point_cache.size();
+	ERR_FAIL_COND_V_MSG(pc == 0, ret, "No points in Curve3D.");
+
+	const int count = p_offsets.size();
+	ret.resize(count);
+	Vector3 *w = ret.ptrw();
+	const float *r = p_offsets.ptr();
+
+	if (pc == 1) {
+		for (int i = 0; i < count; i++) {
+			w[i] = baked_point_cache[0];
+		}
+		return ret;
+	}
+
+	const real_t length = get_baked_length();
+	const real_t *d = baked_dist_cache.ptr();
+
+	Curve3D::Interval interval = { -1, 0.0 };
+	for (int i = 0; i < count; i++) {
+		real_t offset = CLAMP(r[i], 0.0, length);
+
+		// Offsets are usually increasing (e.g. followers spread along a path), so try the
+		// previous interval and the one after it before falling back to a binary search.
+		int idx = interval.idx;
+		if (idx >= 0 && idx + 2 < pc && offset > d[idx + 1] && offset <= d[idx + 2]) {
+			idx++;
+		}
+		if (idx >= 0 && offset >= d[idx] && offset <= d[idx + 1] && d[idx + 1] - d[idx] >= FLT_EPSILON) {
+			interval.idx = idx;
+			interval.frac = (offset - d[idx]) / (d[idx + 1] - d[idx]);
+		} else {
+			interval = _find_interval(offset);
+		}
+
+		w[i] = _sample_baked(interval, p_cubic);
+	}
+
+	return ret;
+}
+
 Transform3D Curve3D::sample_baked_with_rotation(real_t p_offset, bool p_cubic, bool p_apply_tilt) const {
 	if (baked_cache_dirty) {
 		_bake();
@@ -2316,6 +2365,7 @@ void Curve3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_baked_length"), &Curve3D::get_baked_length);
 	ClassDB::bind_method(D_METHOD("sample_baked", "offset", "cubic"), &Curve3D::sample_baked, DEFVAL(0.0), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("sample_baked_array", "offsets", "cubic"), &Curve3D::sample_baked_array, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("sample_baked_with_rotation", "offset", "cubic", "apply_tilt"), &Curve3D::sample_baked_with_rotation, DEFVAL(0.0), DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("sample_baked_up_vector", "offset", "apply_tilt"), &Curve3D::sample_baked_up_vector, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_baked_points"), &Curve3D::get_baked_points);
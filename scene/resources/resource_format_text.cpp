@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/missing_resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/object/script_language.h"
 
 ///
@@ -1380,19 +1381,132 @@ ResourceUID::ID ResourceLoaderText::get_uid(Ref<FileAccess> p_f) {
 
 /////////////////////
 
+#ifdef TOOLS_ENABLED
+bool ResourceFormatLoaderText::use_binary_cache = false;
+String ResourceFormatLoaderText::binary_cache_dir;
+
+String ResourceFormatLoaderText::get_binary_cache_path(const String &p_path) {
+	// Keyed by source path like imported files, so each source overwrites its own entry when it changes.
+	String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+	String dir = binary_cache_dir;
+	if (dir.is_empty()) {
+		dir = ProjectSettings::get_singleton()->get_project_data_path().path_join("text_resource_cache");
+	}
+	return dir.path_join(local_path.get_file() + "-" + local_path.md5_text() + ".res");
+}
+
+// The source stamp is stored next to the cache entry, in the same format as the .md5 files of imported resources.
+static bool _read_binary_cache_stamp(const String &p_stamp_path, uint64_t &r_modified_time, uint64_t &r_size, String &r_md5) {
+	Ref<FileAccess> f = FileAccess::open(p_stamp_path, FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	VariantParser::StreamFile stream;
+	stream.f = f;
+
+	String assign;
+	Variant value;
+	VariantParser::Tag next_tag;
+	int lines = 0;
+	String error_text;
+
+	while (true) {
+		assign = Variant();
+		next_tag.fields.clear();
+		next_tag.name = String();
+
+		Error err = VariantParser::parse_tag_assign_eof(&stream, lines, error_text, next_tag, assign, value, nullptr, true);
+		if (err == ERR_FILE_EOF) {
+			break;
+		} else if (err != OK) {
+			return false;
+		}
+		if (assign == "source_modified_time") {
+			r_modified_time = value;
+		} else if (assign == "source_size") {
+			r_size = value;
+		} else if (assign == "source_md5") {
+			r_md5 = value;
+		}
+	}
+
+	return !r_md5.is_empty();
+}
+
+static void _write_binary_cache_stamp(const String &p_stamp_path, uint64_t p_modified_time, uint64_t p_size, const String &p_md5) {
+	Ref<FileAccess> f = FileAccess::open(p_stamp_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Cannot open binary cache stamp file '" + p_stamp_path + "'.");
+
+	f->store_line("source_modified_time=" + itos(p_modified_time));
+	f->store_line("source_size=" + itos(p_size));
+	f->store_line("source_md5=\"" + p_md5 + "\"");
+}
+
+bool ResourceFormatLoaderText::_is_binary_cache_valid(const String &p_path, uint64_t p_size, const String &p_cache_path) const {
+	if (!FileAccess::exists(p_cache_path)) {
+		return false;
+	}
+
+	uint64_t stored_modified_time = 0;
+	uint64_t stored_size = 0;
+	String stored_md5;
+	if (!_read_binary_cache_stamp(p_cache_path + ".md5", stored_modified_time, stored_size, stored_md5)) {
+		return false;
+	}
+
+	uint64_t modified_time = FileAccess::get_modified_time(p_path);
+	if (modified_time == stored_modified_time && p_size == stored_size) {
+		return true;
+	}
+
+	// The file was touched, only hash it to tell whether its contents actually changed.
+	String md5 = FileAccess::get_md5(p_path);
+	if (md5 != stored_md5) {
+		return false;
+	}
+	_write_binary_cache_stamp(p_cache_path + ".md5", modified_time, p_size, md5);
+	return true;
+}
+#endif
+
 Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	if (r_error) {
 		*r_error = ERR_CANT_OPEN;
 	}
 
+	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+
 	Error err;
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
+#ifdef TOOLS_ENABLED
+	String cache_path;
+	uint64_t source_modified_time = 0;
+	uint64_t source_size = 0;
+	String source_md5;
+	if (use_binary_cache) {
+		cache_path = get_binary_cache_path(path);
+		source_size = f->get_length();
+		if (_is_binary_cache_valid(p_path, source_size, cache_path)) {
+			Ref<ResourceFormatLoaderBinary> binary_loader;
+			binary_loader.instantiate();
+			Ref<Resource> res = binary_loader->load(cache_path, path, r_error, p_use_sub_threads, r_progress, p_cache_mode);
+			if (res.is_valid()) {
+				return res;
+			}
+			// Unusable cache entry (e.g. written by an incompatible version), parse the text again and overwrite it.
+		}
+		// Stamp the source before parsing it, so an edit made meanwhile invalidates the new entry.
+		source_modified_time = FileAccess::get_modified_time(p_path);
+		source_md5 = FileAccess::get_md5(p_path);
+	}
+#endif
+
 	ResourceLoaderText loader;
-	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	switch (p_cache_mode) {
 		case CACHE_MODE_IGNORE:
 		case CACHE_MODE_REUSE:
@@ -1419,6 +1533,16 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 		*r_error = err;
 	}
 	if (err == OK) {
+#ifdef TOOLS_ENABLED
+		if (!cache_path.is_empty() && !source_md5.is_empty() && DirAccess::make_dir_recursive_absolute(cache_path.get_base_dir()) == OK) {
+			// Bypass ResourceSaver so save callbacks don't treat the cache entry as a project file.
+			if (ResourceFormatSaverBinary::singleton->save(loader.get_resource(), cache_path) == OK) {
+				_write_binary_cache_stamp(cache_path + ".md5", source_modified_time, source_size, source_md5);
+			} else {
+				WARN_PRINT("Couldn't write binary cache for text resource '" + path + "'.");
+			}
+		}
+#endif
 		return loader.get_resource();
 	} else {
 		return Ref<Resource>();
@@ -144,8 +144,19 @@ public:
 };
 
 class ResourceFormatLoaderText : public ResourceFormatLoader {
+#ifdef TOOLS_ENABLED
+	bool _is_binary_cache_valid(const String &p_path, uint64_t p_size, const String &p_cache_path) const;
+#endif
+
 public:
 	static ResourceFormatLoaderText *singleton;
+#ifdef TOOLS_ENABLED
+	static bool use_binary_cache;
+	static String binary_cache_dir; // Defaults to the project data folder if empty.
+
+	static String get_binary_cache_path(const String &p_path);
+#endif
+
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
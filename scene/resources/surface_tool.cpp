@@ -40,6 +40,12 @@ SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::DecodeVertexBufferFunc SurfaceTool::decode_vertex_buffer_func = nullptr;
+SurfaceTool::DecodeIndexBufferFunc SurfaceTool::decode_index_buffer_func = nullptr;
+SurfaceTool::DecodeIndexBufferFunc SurfaceTool::decode_index_sequence_func = nullptr;
+SurfaceTool::DecodeFilterFunc SurfaceTool::decode_filter_oct_func = nullptr;
+SurfaceTool::DecodeFilterFunc SurfaceTool::decode_filter_quat_func = nullptr;
+SurfaceTool::DecodeFilterFunc SurfaceTool::decode_filter_exp_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -98,6 +98,15 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	typedef int (*DecodeVertexBufferFunc)(void *destination, size_t vertex_count, size_t vertex_size, const unsigned char *buffer, size_t buffer_size);
+	static DecodeVertexBufferFunc decode_vertex_buffer_func;
+	typedef int (*DecodeIndexBufferFunc)(void *destination, size_t index_count, size_t index_size, const unsigned char *buffer, size_t buffer_size);
+	static DecodeIndexBufferFunc decode_index_buffer_func;
+	static DecodeIndexBufferFunc decode_index_sequence_func;
+	typedef void (*DecodeFilterFunc)(void *buffer, size_t count, size_t stride);
+	static DecodeFilterFunc decode_filter_oct_func;
+	static DecodeFilterFunc decode_filter_quat_func;
+	static DecodeFilterFunc decode_filter_exp_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
 private:
@@ -607,14 +607,8 @@ void AudioServer::_mix_step() {
 			for (uint32_t j = 0; j < buffer_size; j++) {
 				buf[j] *= volume;
 
-				float l = ABS(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = ABS(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
-				}
+				peak.left = MAX(peak.left, ABS(buf[j].left));
+				peak.right = MAX(peak.right, ABS(buf[j].right));
 			}
 
 			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
@@ -646,6 +640,11 @@ void AudioServer::_mix_step() {
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	// Ramp the volume from a precomputed delta and reciprocal, instead of dividing and
+	// blending twice per frame, so the compiler can keep the loops vectorized.
+	const float inv_buffer_size = 1.0f / buffer_size;
+	const AudioFrame vol_delta = p_vol_final - p_vol_start;
+
 	if (p_highshelf_gain != 0) {
 		AudioFilterSW filter;
 		filter.set_mode(AudioFilterSW::HIGHSHELF);
@@ -666,8 +665,7 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
+			AudioFrame vol = p_vol_start + vol_delta * ((float)frame_idx * inv_buffer_size);
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.left);
 			p_processor_r->process_one_interp(mixed.right);
@@ -677,8 +675,7 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 	} else {
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
+			p_out_buf[frame_idx] += (p_vol_start + vol_delta * ((float)frame_idx * inv_buffer_size)) * p_source_buf[frame_idx];
 		}
 	}
 }
@@ -142,10 +142,15 @@ Error MovieWriterPNGWAV::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 Error MovieWriterPNGWAV::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
 	ERR_FAIL_COND_V(!f_wav.is_valid(), ERR_UNCONFIGURED);
 
-	Vector<uint8_t> png_buffer = p_image->save_png_to_buffer();
+	PNGFrame *frame = memnew(PNGFrame);
+	frame->image = p_image;
+	frame->path = base_path + zeros_str(frame_count) + ".png";
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	png_tasks.push_back(pool->add_template_task(this, &MovieWriterPNGWAV::_save_png_task, frame, false, SNAME("MovieWriterPNG")));
+	// Keep the number of frames in memory bounded when encoding can't keep up.
+	_wait_for_png_tasks(MAX(1, pool->get_thread_count()));
 
-	Ref<FileAccess> fi = FileAccess::open(base_path + zeros_str(frame_count) + ".png", FileAccess::WRITE);
-	fi->store_buffer(png_buffer.ptr(), png_buffer.size());
 	f_wav->store_buffer((const uint8_t *)p_audio_data, audio_block_size);
 
 	frame_count++;
@@ -153,7 +158,37 @@ Error MovieWriterPNGWAV::write_frame(const Ref<Image> &p_image, const int32_t *p
 	return OK;
 }
 
+void MovieWriterPNGWAV::_save_png_task(PNGFrame *p_frame) {
+	Vector<uint8_t> png_buffer = p_frame->image->save_png_to_buffer();
+
+	Ref<FileAccess> fi = FileAccess::open(p_frame->path, FileAccess::WRITE);
+	if (fi.is_valid()) {
+		fi->store_buffer(png_buffer.ptr(), png_buffer.size());
+	} else {
+		ERR_PRINT("Can't open file for writing movie frame: " + p_frame->path);
+	}
+
+	memdelete(p_frame);
+}
+
+void MovieWriterPNGWAV::_wait_for_png_tasks(uint32_t p_max_pending) {
+	uint32_t done = 0;
+	while (png_tasks.size() - done > p_max_pending) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(png_tasks[done]);
+		done++;
+	}
+	if (done > 0) {
+		// Remaining tasks keep their submission order.
+		for (uint32_t i = done; i < png_tasks.size(); i++) {
+			png_tasks[i - done] = png_tasks[i];
+		}
+		png_tasks.resize(png_tasks.size() - done);
+	}
+}
+
 void MovieWriterPNGWAV::write_end() {
+	_wait_for_png_tasks(0);
+
 	if (f_wav.is_valid()) {
 		uint32_t total_size = 4 /* WAVE */ + 8 /* fmt+size */ + 16 /* format */ + 8 /* data+size */;
 		uint32_t datasize = f_wav->get_position() - wav_data_size_pos;
@@ -31,6 +31,7 @@
 #ifndef MOVIE_WRITER_PNGWAV_H
 #define MOVIE_WRITER_PNGWAV_H
 
+#include "core/object/worker_thread_pool.h"
 #include "servers/movie_writer/movie_writer.h"
 
 class MovieWriterPNGWAV : public MovieWriter {
@@ -53,6 +54,16 @@ class MovieWriterPNGWAV : public MovieWriter {
 
 	String zeros_str(uint32_t p_index);
 
+	// PNG encoding is slow compared to rendering, so frames are encoded and saved on the WorkerThreadPool.
+	struct PNGFrame {
+		Ref<Image> image;
+		String path;
+	};
+	LocalVector<WorkerThreadPool::TaskID> png_tasks;
+
+	void _save_png_task(PNGFrame *p_frame);
+	void _wait_for_png_tasks(uint32_t p_max_pending);
+
 protected:
 	virtual uint32_t get_audio_mix_rate() const override;
 	virtual AudioServer::SpeakerMode get_audio_speaker_mode() const override;
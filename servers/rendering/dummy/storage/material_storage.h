@@ -93,6 +93,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_material, const StringName &p_param) const override { return Variant(); }
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override { return RS::ShaderNativeSourceCode(); };
+	virtual void shader_warm_up_pipelines(RID p_shader) override {}
 
 	/* MATERIAL API */
 	virtual RID material_allocate() override { return RID(); }
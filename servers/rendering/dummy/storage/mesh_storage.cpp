@@ -79,6 +79,14 @@ void MeshStorage::_multimesh_free(RID p_rid) {
 	multimesh_owner.free(p_rid);
 }
 
+void MeshStorage::_multimesh_allocate_data(RID p_multimesh, int p_instances, RS::MultimeshTransformFormat p_transform_format, bool p_use_colors, bool p_use_custom_data) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	multimesh->instances = p_instances;
+	multimesh->stride = (p_transform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12) + (p_use_colors ? 4 : 0) + (p_use_custom_data ? 4 : 0);
+	multimesh->buffer.clear();
+}
+
 void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL(multimesh);
@@ -87,6 +95,25 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	memcpy(cache_data, p_buffer.ptr(), p_buffer.size() * sizeof(float));
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride == 0);
+	ERR_FAIL_COND(p_buffer.size() % multimesh->stride != 0);
+	int count = p_buffer.size() / multimesh->stride;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + count > multimesh->instances);
+	if (count == 0) {
+		return;
+	}
+
+	// Instances that were never set read back as zeroes, like in the other backends.
+	if (multimesh->buffer.size() != multimesh->instances * multimesh->stride) {
+		multimesh->buffer.resize_zeroed(multimesh->instances * multimesh->stride);
+	}
+	float *cache_data = multimesh->buffer.ptrw();
+	memcpy(cache_data + p_first_instance * multimesh->stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+}
+
 Vector<float> MeshStorage::_multimesh_get_buffer(RID p_multimesh) const {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
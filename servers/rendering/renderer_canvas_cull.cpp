@@ -236,6 +236,57 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 	}
 }
 
+void RendererCanvasCull::_mark_subtree_rect_dirty(Item *p_canvas_item) {
+	p_canvas_item->subtree_rect_dirty = true;
+
+	Item *parent = canvas_item_owner.owns(p_canvas_item->parent) ? canvas_item_owner.get_or_null(p_canvas_item->parent) : nullptr;
+	while (parent && !parent->subtree_rect_dirty) {
+		parent->subtree_rect_dirty = true;
+		parent = canvas_item_owner.owns(parent->parent) ? canvas_item_owner.get_or_null(parent->parent) : nullptr;
+	}
+}
+
+void RendererCanvasCull::_update_subtree_rect(Item *p_canvas_item) {
+	Item *ci = p_canvas_item;
+	if (!ci->subtree_rect_dirty) {
+		return;
+	}
+
+	// Items that draw regardless of their rect, or whose rect changes without going
+	// through this server, prevent the subtree they belong to from being skipped.
+	bool cullable = ci->copy_back_buffer == nullptr && ci->vp_render == nullptr && ci->canvas_group == nullptr && !ci->repeat_source && !ci->update_when_visible && ci->skeleton.is_null();
+
+	Rect2 rect;
+	bool has_rect = false;
+	if (ci->commands != nullptr || ci->custom_rect || ci->visibility_notifier) {
+		// Normalized, as merging rects with negative sizes doesn't produce their union.
+		rect = ci->get_rect().abs();
+		if (ci->visibility_notifier && ci->visibility_notifier->area.size != Vector2()) {
+			rect = rect.merge(ci->visibility_notifier->area.abs());
+		}
+		has_rect = true;
+	}
+
+	for (int i = 0; i < ci->child_items.size(); i++) {
+		Item *child = ci->child_items[i];
+		_update_subtree_rect(child);
+
+		cullable = cullable && child->subtree_cullable;
+		if (!child->subtree_has_rect) {
+			continue;
+		}
+
+		Rect2 child_rect = child->xform_curr.xform(child->subtree_rect);
+		rect = has_rect ? rect.merge(child_rect) : child_rect;
+		has_rect = true;
+	}
+
+	ci->subtree_rect = rect;
+	ci->subtree_has_rect = has_rect;
+	ci->subtree_cullable = cullable;
+	ci->subtree_rect_dirty = false;
+}
+
 void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool p_allow_y_sort, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item) {
 	Item *ci = p_canvas_item;
 
@@ -313,6 +364,23 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 	global_rect.position += p_clip_rect.position;
 
+	// Skip the whole subtree when its bounds are off-screen. Interpolated and snapped transforms
+	// can differ from the ones the bounds were computed with, and repeats draw outside of them.
+	if (!_interpolation_data.interpolation_enabled && !snapping_2d_transforms_to_pixel && !(repeat_source_item && (repeat_size.x || repeat_size.y))) {
+		_update_subtree_rect(ci);
+		if (ci->subtree_cullable) {
+			if (!ci->subtree_has_rect) {
+				return;
+			}
+
+			Rect2 subtree_global_rect = final_xform.xform(ci->subtree_rect);
+			subtree_global_rect.position += p_clip_rect.position;
+			if (!p_clip_rect.intersects(subtree_global_rect, true)) {
+				return;
+			}
+		}
+	}
+
 	if (ci->use_parent_material && p_material_owner) {
 		ci->material_owner = p_material_owner;
 	} else {
@@ -457,6 +525,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	canvas_item->repeat_source_item = is_repeat_source ? canvas_item : nullptr;
 	canvas_item->repeat_size = p_mirroring;
 	canvas_item->repeat_times = 1;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repeat_size, int p_repeat_times) {
@@ -469,6 +538,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	canvas_item->repeat_source_item = is_repeat_source ? canvas_item : nullptr;
 	canvas_item->repeat_size = p_repeat_size;
 	canvas_item->repeat_times = p_repeat_times;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_set_modulate(RID p_canvas, const Color &p_color) {
@@ -511,6 +581,7 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
 			}
+			_mark_subtree_rect_dirty(item_owner);
 		}
 
 		canvas_item->parent = RID();
@@ -538,6 +609,7 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	}
 
 	canvas_item->parent = p_parent;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visible(RID p_item, bool p_visible) {
@@ -570,6 +642,7 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	}
 
 	canvas_item->xform_curr = p_transform;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -606,6 +679,7 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_color) {
@@ -634,12 +708,14 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
 
@@ -874,6 +950,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	Vector<int> indices;
 	int point_count = p_points.size();
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandPolygon *pline = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_NULL(pline);
 
@@ -1152,6 +1229,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 			}
 		}
 
+		_mark_subtree_rect_dirty(canvas_item);
 		Item::CommandPolygon *pline = canvas_item->alloc_command<Item::CommandPolygon>();
 		ERR_FAIL_NULL(pline);
 		pline->primitive = RS::PRIMITIVE_LINES;
@@ -1181,6 +1259,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
 	rect->modulate = p_color;
@@ -1348,6 +1427,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 	static const int circle_segments = 64;
 
 	{
+		_mark_subtree_rect_dirty(canvas_item);
 		Item::CommandPolygon *circle = canvas_item->alloc_command<Item::CommandPolygon>();
 		ERR_FAIL_NULL(circle);
 
@@ -1436,6 +1516,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
 	rect->modulate = p_modulate;
@@ -1467,6 +1548,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
 	rect->modulate = p_modulate;
@@ -1501,6 +1583,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
 	rect->modulate = p_modulate;
@@ -1533,6 +1616,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
 	rect->modulate = p_modulate;
@@ -1574,6 +1658,7 @@ void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_r
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
 
@@ -1598,6 +1683,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
 
@@ -1634,6 +1720,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 	Vector<int> indices = Geometry2D::triangulate_polygon(p_points);
 	ERR_FAIL_COND_MSG(indices.is_empty(), "Invalid polygon data, triangulation failed.");
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandPolygon *polygon = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_NULL(polygon);
 	polygon->primitive = RS::PRIMITIVE_TRIANGLES;
@@ -1652,6 +1739,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 	ERR_FAIL_COND(!p_bones.is_empty() && p_bones.size() != vertex_count * 4);
 	ERR_FAIL_COND(!p_weights.is_empty() && p_weights.size() != vertex_count * 4);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandPolygon *polygon = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_NULL(polygon);
 
@@ -1666,6 +1754,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
 	tr->xform = p_transform;
@@ -1676,6 +1765,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 	ERR_FAIL_NULL(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
 	ERR_FAIL_NULL(m);
 	m->mesh = p_mesh;
@@ -1694,6 +1784,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
 	part->particles = p_particles;
@@ -1708,6 +1799,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
 	mm->multimesh = p_mesh;
@@ -1719,6 +1811,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
 	ci->ignore = p_ignore;
@@ -1728,6 +1821,7 @@ void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_an
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item);
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
 	as->animation_length = p_animation_length;
@@ -1768,6 +1862,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 		return;
 	}
 	canvas_item->skeleton = p_skeleton;
+	_mark_subtree_rect_dirty(canvas_item);
 
 	Item::Command *c = canvas_item->commands;
 
@@ -1805,6 +1900,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 		canvas_item->copy_back_buffer->rect = p_rect;
 		canvas_item->copy_back_buffer->full = p_rect == Rect2();
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
@@ -1812,6 +1908,7 @@ void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->clear();
+	_mark_subtree_rect_dirty(canvas_item);
 #ifdef DEBUG_ENABLED
 	if (debug_redraw) {
 		canvas_item->debug_redraw_time = debug_redraw_time;
@@ -1870,6 +1967,7 @@ void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_
 			canvas_item->visibility_notifier = nullptr;
 		}
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_debug_redraw(bool p_enabled) {
@@ -1899,6 +1997,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 	ERR_FAIL_NULL(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
@@ -1920,6 +2019,7 @@ void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::Canva
 		canvas_item->canvas_group->blur_mipmaps = p_blur_mipmaps;
 		canvas_item->canvas_group->clear_margin = p_clear_margin;
 	}
+	_mark_subtree_rect_dirty(canvas_item);
 }
 
 RID RendererCanvasCull::canvas_light_allocate() {
@@ -2425,6 +2525,7 @@ bool RendererCanvasCull::free(RID p_rid) {
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner, canvas_item_owner);
 				}
+				_mark_subtree_rect_dirty(item_owner);
 			}
 		}
 
@@ -476,7 +476,7 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			prev_index_array_rd = index_array_rd;
 		}
 
-		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, pipeline_specialization);
+		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, pipeline_specialization, async_specialization_mask);
 
 		if (pipeline_rd != prev_pipeline_rd) {
 			// checking with prev shader does not make so much sense, as
@@ -802,53 +802,25 @@ _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primit
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
 	return (p_indices - subtractor[p_primitive]) / divisor[p_primitive];
 }
-void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_using_motion_pass, bool p_append) {
+void RenderForwardClustered::_fill_render_list_range(RenderListFillParams *p_params, RenderListFillState &r_state, uint32_t p_from, uint32_t p_to) {
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
-	uint64_t frame = RSG::rasterizer->get_frame_number();
-
-	if (p_render_list == RENDER_LIST_OPAQUE) {
-		scene_state.used_sss = false;
-		scene_state.used_screen_texture = false;
-		scene_state.used_normal_texture = false;
-		scene_state.used_depth_texture = false;
-		scene_state.used_lightmap = false;
-	}
-	uint32_t lightmap_captures_used = 0;
 
-	Plane near_plane = Plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
-	near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
-	float z_max = p_render_data->scene_data->cam_projection.get_z_far() - p_render_data->scene_data->cam_projection.get_z_near();
-
-	RenderList *rl = &render_list[p_render_list];
-	_update_dirty_geometry_instances();
-
-	if (!p_append) {
-		rl->clear();
-		if (p_render_list == RENDER_LIST_OPAQUE) {
-			// Opaque fills motion and alpha lists.
-			render_list[RENDER_LIST_MOTION].clear();
-			render_list[RENDER_LIST_ALPHA].clear();
-		}
-	}
-
-	//fill list
-
-	for (int i = 0; i < (int)p_render_data->instances->size(); i++) {
-		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_render_data->instances)[i]);
+	for (uint32_t i = p_from; i < p_to; i++) {
+		GeometryInstanceForwardClustered *inst = static_cast<GeometryInstanceForwardClustered *>((*p_params->render_data->instances)[i]);
 
 		Vector3 center = inst->transform.origin;
-		if (p_render_data->scene_data->cam_orthogonal) {
+		if (p_params->render_data->scene_data->cam_orthogonal) {
 			if (inst->use_aabb_center) {
-				center = inst->transformed_aabb.get_support(-near_plane.normal);
+				center = inst->transformed_aabb.get_support(-p_params->near_plane.normal);
 			}
-			inst->depth = near_plane.distance_to(center) - inst->sorting_offset;
+			inst->depth = p_params->near_plane.distance_to(center) - inst->sorting_offset;
 		} else {
 			if (inst->use_aabb_center) {
 				center = inst->transformed_aabb.position + (inst->transformed_aabb.size * 0.5);
 			}
-			inst->depth = p_render_data->scene_data->cam_transform.origin.distance_to(center) - inst->sorting_offset;
+			inst->depth = p_params->render_data->scene_data->cam_transform.origin.distance_to(center) - inst->sorting_offset;
 		}
-		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / z_max), 0, 15);
+		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / p_params->z_max), 0, 15);
 
 		uint32_t flags = inst->base_flags; //fill flags if appropriate
 
@@ -861,7 +833,7 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		float fade_alpha = 1.0;
 
 		if (inst->fade_near || inst->fade_far) {
-			float fade_dist = inst->transform.origin.distance_to(p_render_data->scene_data->cam_transform.origin);
+			float fade_dist = inst->transform.origin.distance_to(p_params->render_data->scene_data->cam_transform.origin);
 			// Use `smoothstep()` to make opacity changes more gradual and less noticeable to the player.
 			if (inst->fade_far && fade_dist > inst->fade_far_begin) {
 				fade_alpha = Math::smoothstep(0.0f, 1.0f, 1.0f - (fade_dist - inst->fade_far_begin) / (inst->fade_far_end - inst->fade_far_begin));
@@ -874,7 +846,7 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 
 		flags = (flags & ~INSTANCE_DATA_FLAGS_FADE_MASK) | (uint32_t(fade_alpha * 255.0) << INSTANCE_DATA_FLAGS_FADE_SHIFT);
 
-		if (p_render_list == RENDER_LIST_OPAQUE) {
+		if (p_params->render_list == RENDER_LIST_OPAQUE) {
 			// Setup GI
 			if (inst->lightmap_instance.is_valid()) {
 				int32_t lightmap_cull_index = -1;
@@ -897,9 +869,10 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 				}
 
 			} else if (inst->lightmap_sh) {
-				if (lightmap_captures_used < scene_state.max_lightmap_captures) {
+				uint32_t lightmap_capture_index = p_params->lightmap_captures_used.postincrement();
+				if (lightmap_capture_index < scene_state.max_lightmap_captures) {
 					const Color *src_capture = inst->lightmap_sh->sh;
-					LightmapCaptureData &lcd = scene_state.lightmap_captures[lightmap_captures_used];
+					LightmapCaptureData &lcd = scene_state.lightmap_captures[lightmap_capture_index];
 					for (int j = 0; j < 9; j++) {
 						lcd.sh[j * 4 + 0] = src_capture[j].r;
 						lcd.sh[j * 4 + 1] = src_capture[j].g;
@@ -907,13 +880,12 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 						lcd.sh[j * 4 + 3] = src_capture[j].a;
 					}
 					flags |= INSTANCE_DATA_FLAG_USE_LIGHTMAP_CAPTURE;
-					inst->gi_offset_cache = lightmap_captures_used;
-					lightmap_captures_used++;
+					inst->gi_offset_cache = lightmap_capture_index;
 					uses_lightmap = true;
 				}
 
 			} else {
-				if (p_using_opaque_gi) {
+				if (p_params->using_opaque_gi) {
 					flags |= INSTANCE_DATA_FLAG_USE_GI_BUFFERS;
 				}
 
@@ -938,20 +910,20 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 					flags |= INSTANCE_DATA_FLAG_USE_VOXEL_GI;
 					uses_gi = true;
 				} else {
-					if (p_using_sdfgi && inst->can_sdfgi) {
+					if (p_params->using_sdfgi && inst->can_sdfgi) {
 						flags |= INSTANCE_DATA_FLAG_USE_SDFGI;
 						uses_gi = true;
 					}
 					inst->gi_offset_cache = 0xFFFFFFFF;
 				}
 			}
-			if (p_pass_mode == PASS_MODE_DEPTH_NORMAL_ROUGHNESS || p_pass_mode == PASS_MODE_DEPTH_NORMAL_ROUGHNESS_VOXEL_GI || p_pass_mode == PASS_MODE_COLOR) {
-				bool transform_changed = inst->prev_transform_change_frame == frame;
+			if (p_params->pass_mode == PASS_MODE_DEPTH_NORMAL_ROUGHNESS || p_params->pass_mode == PASS_MODE_DEPTH_NORMAL_ROUGHNESS_VOXEL_GI || p_params->pass_mode == PASS_MODE_COLOR) {
+				bool transform_changed = inst->prev_transform_change_frame == p_params->frame;
 				bool has_mesh_instance = inst->mesh_instance.is_valid();
 				bool uses_particles = inst->base_flags & INSTANCE_DATA_FLAG_PARTICLES;
 				bool is_multimesh_with_motion = !uses_particles && (inst->base_flags & INSTANCE_DATA_FLAG_MULTIMESH) && mesh_storage->_multimesh_uses_motion_vectors_offsets(inst->data->base);
 				bool is_dynamic = transform_changed || has_mesh_instance || uses_particles || is_multimesh_with_motion;
-				if (p_pass_mode == PASS_MODE_COLOR && p_using_motion_pass) {
+				if (p_params->pass_mode == PASS_MODE_COLOR && p_params->using_motion_pass) {
 					uses_motion = is_dynamic;
 				} else if (is_dynamic) {
 					flags |= INSTANCE_DATA_FLAGS_DYNAMIC;
@@ -964,12 +936,12 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 
 		float lod_distance = 0.0;
 
-		if (p_render_data->scene_data->cam_orthogonal) {
+		if (p_params->render_data->scene_data->cam_orthogonal) {
 			lod_distance = 1.0;
 		} else {
 			Vector3 aabb_min = inst->transformed_aabb.position;
 			Vector3 aabb_max = inst->transformed_aabb.position + inst->transformed_aabb.size;
-			Vector3 camera_position = p_render_data->scene_data->main_cam_transform.origin;
+			Vector3 camera_position = p_params->render_data->scene_data->main_cam_transform.origin;
 			Vector3 surface_distance = Vector3(0.0, 0.0, 0.0).max(aabb_min - camera_position).max(camera_position - aabb_max);
 
 			lod_distance = surface_distance.length();
@@ -980,33 +952,24 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			surf->sort.uses_lightmap = 0;
 
 			// LOD
-			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
+			if (p_params->render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
 				uint32_t indices = 0;
-				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
-				if (p_render_data->render_info) {
-					indices = _indices_to_primitives(surf->primitive, indices);
-					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
-					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += indices;
-					}
+				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_params->render_data->scene_data->lod_distance_multiplier, p_params->render_data->scene_data->screen_mesh_lod_threshold, indices);
+				if (p_params->render_data->render_info) {
+					r_state.primitives += _indices_to_primitives(surf->primitive, indices);
 				}
 			} else {
 				surf->sort.lod_index = 0;
-				if (p_render_data->render_info) {
+				if (p_params->render_data->render_info) {
 					uint32_t to_draw = mesh_storage->mesh_surface_get_vertices_drawn_count(surf->surface);
 					to_draw = _indices_to_primitives(surf->primitive, to_draw);
 					to_draw *= inst->instance_count;
-					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
-					} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
-						p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += to_draw;
-					}
+					r_state.primitives += to_draw;
 				}
 			}
 
 			// ADD Element
-			if (p_pass_mode == PASS_MODE_COLOR) {
+			if (p_params->pass_mode == PASS_MODE_COLOR) {
 #ifdef DEBUG_ENABLED
 				bool force_alpha = unlikely(get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_OVERDRAW);
 #else
@@ -1018,46 +981,46 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 				}
 
 				if (!force_alpha && (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE))) {
-					rl->add_element(surf);
+					r_state.elements[RENDER_LIST_FILL_TARGET_MAIN]->push_back(surf);
 				}
 
 				if (force_alpha || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA)) {
 					surf->color_pass_inclusion_mask = COLOR_PASS_FLAG_TRANSPARENT;
-					render_list[RENDER_LIST_ALPHA].add_element(surf);
+					r_state.elements[RENDER_LIST_FILL_TARGET_ALPHA]->push_back(surf);
 					if (uses_gi) {
 						surf->sort.uses_forward_gi = 1;
 					}
-				} else if (p_using_motion_pass && (uses_motion || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_MOTION_VECTOR))) {
+				} else if (p_params->using_motion_pass && (uses_motion || (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_MOTION_VECTOR))) {
 					surf->color_pass_inclusion_mask = COLOR_PASS_FLAG_MOTION_VECTORS;
-					render_list[RENDER_LIST_MOTION].add_element(surf);
+					r_state.elements[RENDER_LIST_FILL_TARGET_MOTION]->push_back(surf);
 				} else {
 					surf->color_pass_inclusion_mask = 0;
 				}
 
 				if (uses_lightmap) {
 					surf->sort.uses_lightmap = 1;
-					scene_state.used_lightmap = true;
+					r_state.used_lightmap = true;
 				}
 
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_SUBSURFACE_SCATTERING) {
-					scene_state.used_sss = true;
+					r_state.used_sss = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_SCREEN_TEXTURE) {
-					scene_state.used_screen_texture = true;
+					r_state.used_screen_texture = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_NORMAL_TEXTURE) {
-					scene_state.used_normal_texture = true;
+					r_state.used_normal_texture = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_DEPTH_TEXTURE) {
-					scene_state.used_depth_texture = true;
+					r_state.used_depth_texture = true;
 				}
-			} else if (p_pass_mode == PASS_MODE_SHADOW || p_pass_mode == PASS_MODE_SHADOW_DP) {
+			} else if (p_params->pass_mode == PASS_MODE_SHADOW || p_params->pass_mode == PASS_MODE_SHADOW_DP) {
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_SHADOW) {
-					rl->add_element(surf);
+					r_state.elements[RENDER_LIST_FILL_TARGET_MAIN]->push_back(surf);
 				}
 			} else {
 				if (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
-					rl->add_element(surf);
+					r_state.elements[RENDER_LIST_FILL_TARGET_MAIN]->push_back(surf);
 				}
 			}
 
@@ -1066,7 +1029,119 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			surf = surf->next;
 		}
 	}
+}
+
+void RenderForwardClustered::_fill_render_list_chunk(uint32_t p_chunk, RenderListFillParams *p_params) {
+	uint32_t from = p_chunk * RENDER_LIST_FILL_CHUNK_SIZE;
+	uint32_t to = MIN(from + RENDER_LIST_FILL_CHUNK_SIZE, uint32_t(p_params->render_data->instances->size()));
+	_fill_render_list_range(p_params, p_params->states[p_chunk], from, to);
+}
+
+void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi, bool p_using_opaque_gi, bool p_using_motion_pass, bool p_append) {
+	if (p_render_list == RENDER_LIST_OPAQUE) {
+		scene_state.used_sss = false;
+		scene_state.used_screen_texture = false;
+		scene_state.used_normal_texture = false;
+		scene_state.used_depth_texture = false;
+		scene_state.used_lightmap = false;
+	}
+
+	RenderListFillParams params;
+	params.render_list = p_render_list;
+	params.render_data = p_render_data;
+	params.pass_mode = p_pass_mode;
+	params.using_sdfgi = p_using_sdfgi;
+	params.using_opaque_gi = p_using_opaque_gi;
+	params.using_motion_pass = p_using_motion_pass;
+	params.frame = RSG::rasterizer->get_frame_number();
+
+	params.near_plane = Plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
+	params.near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
+	params.z_max = p_render_data->scene_data->cam_projection.get_z_far() - p_render_data->scene_data->cam_projection.get_z_near();
+
+	RenderList *rl = &render_list[p_render_list];
+	_update_dirty_geometry_instances();
+
+	if (!p_append) {
+		rl->clear();
+		if (p_render_list == RENDER_LIST_OPAQUE) {
+			// Opaque fills motion and alpha lists.
+			render_list[RENDER_LIST_MOTION].clear();
+			render_list[RENDER_LIST_ALPHA].clear();
+		}
+	}
+
+	//fill list
 
+	uint32_t instance_count = p_render_data->instances->size();
+	uint32_t chunk_count = Math::division_round_up(instance_count, RENDER_LIST_FILL_CHUNK_SIZE);
+	bool use_threads = chunk_count > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1;
+
+	if (render_list_fill_states.size() < MAX(chunk_count, 1u)) {
+		render_list_fill_states.resize(MAX(chunk_count, 1u));
+	}
+
+	for (uint32_t i = 0; i < (use_threads ? chunk_count : 1u); i++) {
+		RenderListFillState &state = render_list_fill_states[i];
+		for (uint32_t j = 0; j < RENDER_LIST_FILL_TARGET_MAX; j++) {
+			state.local_elements[j].clear();
+			state.elements[j] = use_threads ? &state.local_elements[j] : nullptr;
+		}
+		state.primitives = 0;
+		state.used_sss = false;
+		state.used_screen_texture = false;
+		state.used_normal_texture = false;
+		state.used_depth_texture = false;
+		state.used_lightmap = false;
+	}
+
+	if (!use_threads) {
+		RenderListFillState &state = render_list_fill_states[0];
+		state.elements[RENDER_LIST_FILL_TARGET_MAIN] = &rl->elements;
+		state.elements[RENDER_LIST_FILL_TARGET_ALPHA] = &render_list[RENDER_LIST_ALPHA].elements;
+		state.elements[RENDER_LIST_FILL_TARGET_MOTION] = &render_list[RENDER_LIST_MOTION].elements;
+		_fill_render_list_range(&params, state, 0, instance_count);
+	} else {
+		params.states = render_list_fill_states.ptr();
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_fill_render_list_chunk, &params, chunk_count, -1, true, SNAME("FillRenderList"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Merge in chunk order, so the lists are the same as when filled on a single thread.
+		LocalVector<GeometryInstanceSurfaceDataCache *> *targets[RENDER_LIST_FILL_TARGET_MAX] = { &rl->elements, &render_list[RENDER_LIST_ALPHA].elements, &render_list[RENDER_LIST_MOTION].elements };
+		for (uint32_t i = 0; i < RENDER_LIST_FILL_TARGET_MAX; i++) {
+			uint32_t total = targets[i]->size();
+			for (uint32_t j = 0; j < chunk_count; j++) {
+				total += render_list_fill_states[j].local_elements[i].size();
+			}
+			uint32_t offset = targets[i]->size();
+			targets[i]->resize(total);
+			for (uint32_t j = 0; j < chunk_count; j++) {
+				const LocalVector<GeometryInstanceSurfaceDataCache *> &local = render_list_fill_states[j].local_elements[i];
+				if (local.size()) {
+					memcpy(targets[i]->ptr() + offset, local.ptr(), local.size() * sizeof(GeometryInstanceSurfaceDataCache *));
+					offset += local.size();
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < (use_threads ? chunk_count : 1u); i++) {
+		const RenderListFillState &state = render_list_fill_states[i];
+		if (p_render_data->render_info) {
+			if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
+				p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += state.primitives;
+			} else if (p_render_list == RENDER_LIST_SECONDARY) { //shadow
+				p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += state.primitives;
+			}
+		}
+		scene_state.used_sss |= state.used_sss;
+		scene_state.used_screen_texture |= state.used_screen_texture;
+		scene_state.used_normal_texture |= state.used_normal_texture;
+		scene_state.used_depth_texture |= state.used_depth_texture;
+		scene_state.used_lightmap |= state.used_lightmap;
+	}
+
+	uint32_t lightmap_captures_used = MIN(params.lightmap_captures_used.get(), scene_state.max_lightmap_captures);
 	if (p_render_list == RENDER_LIST_OPAQUE && lightmap_captures_used) {
 		RD::get_singleton()->buffer_update(scene_state.lightmap_capture_buffer, 0, sizeof(LightmapCaptureData) * lightmap_captures_used, scene_state.lightmap_captures);
 	}
@@ -4261,6 +4336,11 @@ RenderForwardClustered::RenderForwardClustered() {
 		defines += "\n#define SDFGI_OCT_SIZE " + itos(gi.sdfgi_get_lightprobe_octahedron_size()) + "\n";
 		defines += "\n#define MAX_DIRECTIONAL_LIGHT_DATA_STRUCTS " + itos(MAX_DIRECTIONAL_LIGHTS) + "\n";
 
+		// Only soft shadow filtering is allowed to be missing for a few frames. Fog, GI and light projectors
+		// would visibly pop in, so their specializations always block until compiled.
+		bool async_specialization_compile = GLOBAL_GET("rendering/shader_compiler/async_specialization_compile");
+		async_specialization_mask = async_specialization_compile ? (SceneShaderForwardClustered::SHADER_SPECIALIZATION_SOFT_SHADOWS | SceneShaderForwardClustered::SHADER_SPECIALIZATION_DIRECTIONAL_SOFT_SHADOWS) : 0;
+
 		bool force_vertex_shading = GLOBAL_GET("rendering/shading/overrides/force_vertex_shading");
 		if (force_vertex_shading) {
 			defines += "\n#define USE_VERTEX_LIGHTING\n";
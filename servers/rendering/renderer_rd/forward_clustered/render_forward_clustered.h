@@ -571,6 +571,54 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	RenderList render_list[RENDER_LIST_MAX];
 
+	/* Render List Filling */
+
+	// Instances are split into chunks of this size when filling render lists on multiple threads.
+	static constexpr uint32_t RENDER_LIST_FILL_CHUNK_SIZE = 256;
+
+	enum RenderListFillTarget {
+		RENDER_LIST_FILL_TARGET_MAIN,
+		RENDER_LIST_FILL_TARGET_ALPHA,
+		RENDER_LIST_FILL_TARGET_MOTION,
+		RENDER_LIST_FILL_TARGET_MAX,
+	};
+
+	// Output of filling a range of instances. When filling on a single thread, the element
+	// lists point directly at the render lists; otherwise they point at the local lists,
+	// which are appended to the render lists in chunk order afterwards.
+	struct RenderListFillState {
+		LocalVector<GeometryInstanceSurfaceDataCache *> *elements[RENDER_LIST_FILL_TARGET_MAX] = {};
+		LocalVector<GeometryInstanceSurfaceDataCache *> local_elements[RENDER_LIST_FILL_TARGET_MAX];
+		uint64_t primitives = 0;
+		bool used_sss = false;
+		bool used_screen_texture = false;
+		bool used_normal_texture = false;
+		bool used_depth_texture = false;
+		bool used_lightmap = false;
+	};
+
+	struct RenderListFillParams {
+		RenderListType render_list = RENDER_LIST_OPAQUE;
+		const RenderDataRD *render_data = nullptr;
+		PassMode pass_mode = PASS_MODE_COLOR;
+		bool using_sdfgi = false;
+		bool using_opaque_gi = false;
+		bool using_motion_pass = false;
+		Plane near_plane;
+		float z_max = 0.0;
+		uint64_t frame = 0;
+		SafeNumeric<uint32_t> lightmap_captures_used;
+		RenderListFillState *states = nullptr;
+	};
+
+	LocalVector<RenderListFillState> render_list_fill_states;
+
+	void _fill_render_list_range(RenderListFillParams *p_params, RenderListFillState &r_state, uint32_t p_from, uint32_t p_to);
+	void _fill_render_list_chunk(uint32_t p_chunk, RenderListFillParams *p_params);
+
+	// Specializations that may be drawn without while the requested pipeline compiles in the background.
+	uint32_t async_specialization_mask = 0;
+
 	virtual void _update_shader_quality_settings() override;
 
 	/* Effects */
@@ -40,6 +40,8 @@ using namespace RendererSceneRenderImplementation;
 void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	//compile
 
+	_wait_for_background_compilation();
+
 	code = p_code;
 	valid = false;
 	ubo_size = 0;
@@ -427,6 +429,91 @@ RS::ShaderNativeSourceCode SceneShaderForwardClustered::ShaderData::get_native_s
 	return shader_singleton->shader.version_get_native_source_code(version);
 }
 
+PipelineCacheRD *SceneShaderForwardClustered::ShaderData::_get_pipeline_by_index(uint32_t p_index) {
+	const uint32_t pipeline_count = CULL_VARIANT_MAX * RS::PRIMITIVE_MAX * PIPELINE_VERSION_MAX;
+	if (p_index < pipeline_count) {
+		return &pipelines[0][0][0] + p_index;
+	}
+	return &color_pipelines[0][0][0] + (p_index - pipeline_count);
+}
+
+void SceneShaderForwardClustered::ShaderData::_warm_up_pipeline(uint32_t p_index, void *p_userdata) {
+	const PipelineWarmUpJob &job = warm_up_jobs[p_index];
+	job.pipeline->get_render_pipeline(job.key.vertex_id, job.key.framebuffer_id, job.key.wireframe, job.key.render_pass, job.key.bool_specializations);
+}
+
+void SceneShaderForwardClustered::ShaderData::_wait_for_background_compilation() {
+	if (warm_up_group != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(warm_up_group);
+		warm_up_group = -1;
+	}
+	warm_up_jobs.clear();
+
+	// Specializations compiled in the background by the pipelines themselves.
+	const uint32_t slot_count = CULL_VARIANT_MAX * RS::PRIMITIVE_MAX * (PIPELINE_VERSION_MAX + PIPELINE_COLOR_PASS_FLAG_COUNT);
+	for (uint32_t i = 0; i < slot_count; i++) {
+		_get_pipeline_by_index(i)->wait_for_pending_versions();
+	}
+}
+
+void SceneShaderForwardClustered::ShaderData::warm_up_pipelines() {
+	_wait_for_background_compilation();
+	if (!valid) {
+		return;
+	}
+
+	// We can't know in advance which meshes and framebuffers this shader will be drawn with, so compile
+	// the versions every other spatial shader already needed for the same slot. Slots with a different
+	// vertex input mask are skipped, as their vertex formats may not provide the attributes we read.
+	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
+	const uint32_t slot_count = CULL_VARIANT_MAX * RS::PRIMITIVE_MAX * (PIPELINE_VERSION_MAX + PIPELINE_COLOR_PASS_FLAG_COUNT);
+	LocalVector<PipelineCacheRD::VersionKey> keys;
+	for (uint32_t i = 0; i < slot_count; i++) {
+		PipelineCacheRD *pipeline = _get_pipeline_by_index(i);
+		if (!pipeline->is_valid()) {
+			continue;
+		}
+
+		uint64_t input_mask = pipeline->get_vertex_input_mask();
+		keys.clear();
+		for (SelfList<ShaderData> *E = shader_singleton->shader_list.first(); E; E = E->next()) {
+			ShaderData *other = E->self();
+			if (other == this || !other->valid) {
+				continue;
+			}
+			PipelineCacheRD *other_pipeline = other->_get_pipeline_by_index(i);
+			if (!other_pipeline->is_valid() || other_pipeline->get_vertex_input_mask() != input_mask) {
+				continue;
+			}
+			other_pipeline->get_version_keys(keys);
+		}
+
+		uint32_t first_job = warm_up_jobs.size();
+		for (const PipelineCacheRD::VersionKey &key : keys) {
+			if (pipeline->has_version(key)) {
+				continue;
+			}
+			bool duplicate = false;
+			for (uint32_t j = first_job; j < warm_up_jobs.size(); j++) {
+				if (warm_up_jobs[j].key == key) {
+					duplicate = true;
+					break;
+				}
+			}
+			if (!duplicate) {
+				PipelineWarmUpJob job;
+				job.pipeline = pipeline;
+				job.key = key;
+				warm_up_jobs.push_back(job);
+			}
+		}
+	}
+
+	if (warm_up_jobs.size()) {
+		warm_up_group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderData::_warm_up_pipeline, nullptr, warm_up_jobs.size(), -1, false, SNAME("ScenePipelineWarmUp"));
+	}
+}
+
 SceneShaderForwardClustered::ShaderData::ShaderData() :
 		shader_list_element(this) {
 }
@@ -434,6 +521,7 @@ SceneShaderForwardClustered::ShaderData::ShaderData() :
 SceneShaderForwardClustered::ShaderData::~ShaderData() {
 	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
 	ERR_FAIL_NULL(shader_singleton);
+	_wait_for_background_compilation();
 	//pipeline variants will clear themselves if shader is gone
 	if (version.is_valid()) {
 		shader_singleton->shader.version_free(version);
@@ -858,6 +946,7 @@ void fragment() {
 void SceneShaderForwardClustered::set_default_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_constants) {
 	default_specialization_constants = p_constants;
 	for (SelfList<ShaderData> *E = shader_list.first(); E; E = E->next()) {
+		E->self()->_wait_for_background_compilation();
 		for (int i = 0; i < ShaderData::CULL_VARIANT_MAX; i++) {
 			for (int j = 0; j < RS::PRIMITIVE_MAX; j++) {
 				for (int k = 0; k < SHADER_VERSION_MAX; k++) {
@@ -31,6 +31,7 @@
 #ifndef SCENE_SHADER_FORWARD_CLUSTERED_H
 #define SCENE_SHADER_FORWARD_CLUSTERED_H
 
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/shaders/forward_clustered/scene_forward_clustered.glsl.gen.h"
 
@@ -188,11 +189,24 @@ public:
 		uint64_t last_pass = 0;
 		uint32_t index = 0;
 
+		struct PipelineWarmUpJob {
+			PipelineCacheRD *pipeline = nullptr;
+			PipelineCacheRD::VersionKey key;
+		};
+
+		LocalVector<PipelineWarmUpJob> warm_up_jobs;
+		WorkerThreadPool::GroupID warm_up_group = -1;
+
+		PipelineCacheRD *_get_pipeline_by_index(uint32_t p_index);
+		void _warm_up_pipeline(uint32_t p_index, void *p_userdata);
+		void _wait_for_background_compilation();
+
 		virtual void set_code(const String &p_Code);
 
 		virtual bool is_animated() const;
 		virtual bool casts_shadows() const;
 		virtual RS::ShaderNativeSourceCode get_native_source_code() const;
+		virtual void warm_up_pipelines();
 
 		SelfList<ShaderData> shader_list_element;
 		ShaderData();
@@ -31,6 +31,7 @@
 #include "pipeline_cache_rd.h"
 
 #include "core/os/memory.h"
+#include "core/os/os.h"
 
 RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
 	RD::PipelineMultisampleState multisample_state_version = multisample_state;
@@ -59,6 +60,17 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 
 	RID pipeline = RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
 	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+
+	spin_lock.lock();
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == p_bool_specializations) {
+			// Another thread compiled the same version in the meantime, keep theirs.
+			RID existing = versions[i].pipeline;
+			spin_lock.unlock();
+			RD::get_singleton()->free(pipeline);
+			return existing;
+		}
+	}
 	versions = static_cast<Version *>(memrealloc(versions, sizeof(Version) * (version_count + 1)));
 	versions[version_count].framebuffer_id = p_framebuffer_format_id;
 	versions[version_count].vertex_id = p_vertex_format_id;
@@ -67,10 +79,158 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 	versions[version_count].render_pass = p_render_pass;
 	versions[version_count].bool_specializations = p_bool_specializations;
 	version_count++;
+	spin_lock.unlock();
 	return pipeline;
 }
 
+void PipelineCacheRD::get_version_keys(LocalVector<VersionKey> &r_keys) {
+	spin_lock.lock();
+	for (uint32_t i = 0; i < version_count; i++) {
+		VersionKey key;
+		key.vertex_id = versions[i].vertex_id;
+		key.framebuffer_id = versions[i].framebuffer_id;
+		key.render_pass = versions[i].render_pass;
+		key.wireframe = versions[i].wireframe;
+		key.bool_specializations = versions[i].bool_specializations;
+		r_keys.push_back(key);
+	}
+	spin_lock.unlock();
+}
+
+bool PipelineCacheRD::has_version(const VersionKey &p_key) {
+	bool wireframe = p_key.wireframe || rasterization_state.wireframe;
+	bool found = false;
+	spin_lock.lock();
+	for (uint32_t i = 0; i < version_count; i++) {
+		if (versions[i].vertex_id == p_key.vertex_id && versions[i].framebuffer_id == p_key.framebuffer_id && versions[i].wireframe == wireframe && versions[i].render_pass == p_key.render_pass && versions[i].bool_specializations == p_key.bool_specializations) {
+			found = true;
+			break;
+		}
+	}
+	spin_lock.unlock();
+	return found;
+}
+
+void PipelineCacheRD::_generate_version_task(VersionKey p_key) {
+	_generate_version(p_key.vertex_id, p_key.framebuffer_id, p_key.wireframe, p_key.render_pass, p_key.bool_specializations);
+
+	spin_lock.lock();
+	for (PendingVersion &pending : pending_versions) {
+		if (pending.key == p_key) {
+			pending.done = true;
+			break;
+		}
+	}
+	spin_lock.unlock();
+}
+
+RID PipelineCacheRD::_get_fallback_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, uint32_t p_optional_specializations) {
+	VersionKey key;
+	key.vertex_id = p_vertex_format_id;
+	key.framebuffer_id = p_framebuffer_format_id;
+	key.render_pass = p_render_pass;
+	key.wireframe = p_wireframe;
+	key.bool_specializations = p_bool_specializations;
+
+	LocalVector<WorkerThreadPool::TaskID> finished_tasks;
+	bool already_pending = false;
+	bool post_task = false;
+	RID fallback;
+
+	spin_lock.lock();
+
+	// Use the compiled version that enables the most of the requested optional specializations, if any.
+	// Only the optional ones may be missing, every other specialization must match exactly.
+	const uint32_t required_specializations = p_bool_specializations & ~p_optional_specializations;
+	uint32_t best_bits = 0;
+	for (uint32_t i = 0; i < version_count; i++) {
+		const Version &version = versions[i];
+		if (version.vertex_id != p_vertex_format_id || version.framebuffer_id != p_framebuffer_format_id || version.wireframe != p_wireframe || version.render_pass != p_render_pass || (version.bool_specializations & ~p_bool_specializations) || (version.bool_specializations & ~p_optional_specializations) != required_specializations) {
+			continue;
+		}
+		uint32_t bits = 0;
+		for (uint32_t specializations = version.bool_specializations; specializations; specializations &= specializations - 1) {
+			bits++;
+		}
+		if (fallback.is_null() || bits > best_bits) {
+			fallback = version.pipeline;
+			best_bits = bits;
+		}
+	}
+
+	if (fallback.is_valid()) {
+		for (uint32_t i = 0; i < pending_versions.size(); i++) {
+			if (pending_versions[i].done && pending_versions[i].task != WorkerThreadPool::INVALID_TASK_ID) {
+				finished_tasks.push_back(pending_versions[i].task);
+				pending_versions.remove_at_unordered(i);
+				i--;
+			} else if (pending_versions[i].key == key) {
+				already_pending = true;
+			}
+		}
+
+		if (!already_pending) {
+			// Recorded before unlocking, so wait_for_pending_versions() knows a task is being posted.
+			PendingVersion pending;
+			pending.key = key;
+			pending_versions.push_back(pending);
+			post_task = true;
+		}
+	}
+
+	spin_lock.unlock();
+
+	if (post_task) {
+		// Posted without the lock held, since the task takes it (and may even run inline without pool threads).
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_template_task(this, &PipelineCacheRD::_generate_version_task, key, false, String("PipelineSpecializationCompile"));
+
+		spin_lock.lock();
+		for (PendingVersion &pending : pending_versions) {
+			if (pending.key == key && pending.task == WorkerThreadPool::INVALID_TASK_ID) {
+				pending.task = task;
+				break;
+			}
+		}
+		spin_lock.unlock();
+	}
+
+	for (WorkerThreadPool::TaskID task : finished_tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+
+	return fallback;
+}
+
+void PipelineCacheRD::wait_for_pending_versions() {
+	LocalVector<PendingVersion> pending;
+	while (true) {
+		spin_lock.lock();
+		bool posting = false;
+		for (const PendingVersion &E : pending_versions) {
+			if (E.task == WorkerThreadPool::INVALID_TASK_ID) {
+				posting = true;
+				break;
+			}
+		}
+		if (!posting) {
+			pending = pending_versions;
+			pending_versions.clear();
+			spin_lock.unlock();
+			break;
+		}
+		spin_lock.unlock();
+		// Another thread is posting a task, wait until its ID is known.
+		OS::get_singleton()->delay_usec(1);
+	}
+
+	for (const PendingVersion &E : pending) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(E.task);
+	}
+}
+
 void PipelineCacheRD::_clear() {
+	wait_for_pending_versions();
+
 	// TODO: Clear should probably recompile all the variants already compiled instead to avoid stalls? Needs discussion.
 	if (versions) {
 		for (uint32_t i = 0; i < version_count; i++) {
@@ -31,7 +31,9 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/local_vector.h"
 #include "servers/rendering/rendering_device.h"
 
 class PipelineCacheRD {
@@ -60,8 +62,35 @@ class PipelineCacheRD {
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	// Called with the spin lock released, so other threads can keep fetching already compiled versions
+	// (or compile different ones) while the driver builds this pipeline.
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
 
+public:
+	struct VersionKey {
+		RD::VertexFormatID vertex_id;
+		RD::FramebufferFormatID framebuffer_id;
+		uint32_t render_pass;
+		bool wireframe;
+		uint32_t bool_specializations;
+
+		bool operator==(const VersionKey &p_key) const {
+			return vertex_id == p_key.vertex_id && framebuffer_id == p_key.framebuffer_id && render_pass == p_key.render_pass && wireframe == p_key.wireframe && bool_specializations == p_key.bool_specializations;
+		}
+	};
+
+private:
+	// Specialized versions being compiled in the background, see _get_fallback_version().
+	struct PendingVersion {
+		VersionKey key;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		bool done = false;
+	};
+
+	LocalVector<PendingVersion> pending_versions;
+
+	void _generate_version_task(VersionKey p_key);
+	RID _get_fallback_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations, uint32_t p_optional_specializations);
 	void _clear();
 
 public:
@@ -69,7 +98,11 @@ public:
 	void update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants);
 	void update_shader(RID p_shader);
 
-	_FORCE_INLINE_ RID get_render_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe = false, uint32_t p_render_pass = 0, uint32_t p_bool_specializations = 0) {
+	// p_optional_specializations are bool specializations that only affect quality and may be missing for a few frames.
+	// If the requested specialization isn't compiled yet, a compiled version lacking some of those (and matching
+	// all the others) is returned instead, if any, while the requested one is compiled on a worker thread and
+	// picked up by later calls once ready. Otherwise, this waits for the requested one to compile.
+	_FORCE_INLINE_ RID get_render_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe = false, uint32_t p_render_pass = 0, uint32_t p_bool_specializations = 0, uint32_t p_optional_specializations = 0) {
 #ifdef DEBUG_ENABLED
 		ERR_FAIL_COND_V_MSG(shader.is_null(), RID(),
 				"Attempted to use an unused shader variant (shader is null),");
@@ -86,11 +119,26 @@ public:
 				return result;
 			}
 		}
-		result = _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
 		spin_lock.unlock();
-		return result;
+
+		if (p_bool_specializations & p_optional_specializations) {
+			result = _get_fallback_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations, p_optional_specializations);
+			if (result.is_valid()) {
+				return result;
+			}
+		}
+		return _generate_version(p_vertex_format_id, p_framebuffer_format_id, p_wireframe, p_render_pass, p_bool_specializations);
 	}
 
+	_FORCE_INLINE_ bool is_valid() const { return shader.is_valid(); }
+
+	// Used to warm up pipelines ahead of time with the same versions other caches already needed.
+	void get_version_keys(LocalVector<VersionKey> &r_keys);
+	bool has_version(const VersionKey &p_key);
+
+	// Must be called before the shader used by this cache is freed or changed.
+	void wait_for_pending_versions();
+
 	_FORCE_INLINE_ uint64_t get_vertex_input_mask() {
 		if (input_mask == 0) {
 			ERR_FAIL_COND_V(shader.is_null(), 0);
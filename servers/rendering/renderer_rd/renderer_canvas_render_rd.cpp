@@ -2377,9 +2377,11 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				}
 
 				bool has_msdf = bool(rect->flags & CANVAS_RECT_MSDF);
+				bool has_blend = bool(rect->flags & CANVAS_RECT_LCD);
 				TextureState tex_state(rect->texture, texture_filter, texture_repeat, has_msdf, use_linear_colors);
+				uint32_t texture_slot = 0;
 
-				if (tex_state != r_current_batch->tex_info.state) {
+				if (tex_state != r_current_batch->tex_info.state && (has_blend || !_add_batch_texture_slot(r_current_batch, tex_state, texture_slot))) {
 					r_current_batch = _new_batch(r_batch_broken);
 					r_current_batch->tex_info.state = tex_state;
 					_prepare_batch_texture_info(r_current_batch, rect->texture);
@@ -2390,7 +2392,6 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 					modulated = modulated.srgb_to_linear();
 				}
 
-				bool has_blend = bool(rect->flags & CANVAS_RECT_LCD);
 				// Start a new batch if the blend mode has changed,
 				// or blend mode is enabled and the modulation has changed.
 				if (has_blend != r_current_batch->has_blend || (has_blend && modulated != r_current_batch->modulate)) {
@@ -2404,8 +2405,16 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				Rect2 src_rect;
 				Rect2 dst_rect;
 
+				Vector2 texpixel_size = r_current_batch->tex_info.texpixel_size;
+				if (texture_slot > 0) {
+					texpixel_size = r_current_batch->extra_textures[texture_slot - 1].texpixel_size;
+					instance_data->flags |= texture_slot << FLAGS_TEXTURE_SLOT_SHIFT;
+					instance_data->color_texture_pixel_size[0] = texpixel_size.width;
+					instance_data->color_texture_pixel_size[1] = texpixel_size.height;
+				}
+
 				if (rect->texture.is_valid()) {
-					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * r_current_batch->tex_info.texpixel_size, rect->source.size * r_current_batch->tex_info.texpixel_size) : Rect2(0, 0, 1, 1);
+					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
 					dst_rect = Rect2(rect->rect.position, rect->rect.size);
 
 					if (dst_rect.size.width < 0) {
@@ -2808,7 +2817,16 @@ void RendererCanvasRenderRD::_render_batch(RD::DrawListID p_draw_list, PipelineV
 		RD::Uniform u_sampler(RD::UNIFORM_TYPE_SAMPLER, 3, p_batch->tex_info.sampler);
 		RD::Uniform u_instance_data(RD::UNIFORM_TYPE_STORAGE_BUFFER, 4, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[p_batch->instance_buffer_index]);
 
-		RID uniform_set = uniform_set_cache->get_cache(shader.default_version_rd_shader, BATCH_UNIFORM_SET, u_diffuse, u_normal, u_specular, u_sampler, u_instance_data);
+		// Unused slots repeat the main texture.
+		RID extra_diffuse[MAX_BATCH_TEXTURE_SLOTS - 1];
+		for (uint32_t i = 0; i < MAX_BATCH_TEXTURE_SLOTS - 1; i++) {
+			extra_diffuse[i] = i < p_batch->extra_texture_count ? p_batch->extra_textures[i].diffuse : p_batch->tex_info.diffuse;
+		}
+		RD::Uniform u_diffuse_1(RD::UNIFORM_TYPE_TEXTURE, 5, extra_diffuse[0]);
+		RD::Uniform u_diffuse_2(RD::UNIFORM_TYPE_TEXTURE, 6, extra_diffuse[1]);
+		RD::Uniform u_diffuse_3(RD::UNIFORM_TYPE_TEXTURE, 7, extra_diffuse[2]);
+
+		RID uniform_set = uniform_set_cache->get_cache(shader.default_version_rd_shader, BATCH_UNIFORM_SET, u_diffuse, u_normal, u_specular, u_sampler, u_instance_data, u_diffuse_1, u_diffuse_2, u_diffuse_3);
 
 		if (state.current_batch_uniform_set != uniform_set) {
 			state.current_batch_uniform_set = uniform_set;
@@ -3039,6 +3057,12 @@ void RendererCanvasRenderRD::_allocate_instance_buffer() {
 }
 
 void RendererCanvasRenderRD::_prepare_batch_texture_info(Batch *p_current_batch, RID p_texture) const {
+	_prepare_texture_info(&p_current_batch->tex_info, p_texture);
+	// Extra slots were only validated against the previous texture.
+	p_current_batch->extra_texture_count = 0;
+}
+
+void RendererCanvasRenderRD::_prepare_texture_info(TextureInfo *r_info, RID p_texture) const {
 	if (p_texture.is_null()) {
 		p_texture = default_canvas_texture;
 	}
@@ -3046,38 +3070,77 @@ void RendererCanvasRenderRD::_prepare_batch_texture_info(Batch *p_current_batch,
 	RendererRD::TextureStorage::CanvasTextureInfo info =
 			RendererRD::TextureStorage::get_singleton()->canvas_texture_get_info(
 					p_texture,
-					p_current_batch->tex_info.state.texture_filter(),
-					p_current_batch->tex_info.state.texture_repeat(),
-					p_current_batch->tex_info.state.linear_colors(),
-					p_current_batch->tex_info.state.texture_is_data());
+					r_info->state.texture_filter(),
+					r_info->state.texture_repeat(),
+					r_info->state.linear_colors(),
+					r_info->state.texture_is_data());
 
 	// something odd happened
 	if (info.is_null()) {
-		_prepare_batch_texture_info(p_current_batch, default_canvas_texture);
+		_prepare_texture_info(r_info, default_canvas_texture);
 		return;
 	}
 
-	p_current_batch->tex_info.diffuse = info.diffuse;
-	p_current_batch->tex_info.normal = info.normal;
-	p_current_batch->tex_info.specular = info.specular;
-	p_current_batch->tex_info.sampler = info.sampler;
+	r_info->diffuse = info.diffuse;
+	r_info->normal = info.normal;
+	r_info->specular = info.specular;
+	r_info->sampler = info.sampler;
 
 	// cache values to be copied to instance data
 	if (info.specular_color.a < 0.999) {
-		p_current_batch->tex_info.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
+		r_info->flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	}
 
 	if (info.use_normal) {
-		p_current_batch->tex_info.flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
+		r_info->flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
 	}
 
 	uint8_t a = uint8_t(CLAMP(info.specular_color.a * 255.0, 0.0, 255.0));
 	uint8_t b = uint8_t(CLAMP(info.specular_color.b * 255.0, 0.0, 255.0));
 	uint8_t g = uint8_t(CLAMP(info.specular_color.g * 255.0, 0.0, 255.0));
 	uint8_t r = uint8_t(CLAMP(info.specular_color.r * 255.0, 0.0, 255.0));
-	p_current_batch->tex_info.specular_shininess = uint32_t(a) << 24 | uint32_t(b) << 16 | uint32_t(g) << 8 | uint32_t(r);
+	r_info->specular_shininess = uint32_t(a) << 24 | uint32_t(b) << 16 | uint32_t(g) << 8 | uint32_t(r);
+
+	r_info->texpixel_size = Vector2(1.0 / float(info.size.width), 1.0 / float(info.size.height));
+}
 
-	p_current_batch->tex_info.texpixel_size = Vector2(1.0 / float(info.size.width), 1.0 / float(info.size.height));
+bool RendererCanvasRenderRD::_add_batch_texture_slot(Batch *p_current_batch, const TextureState &p_state, uint32_t &r_slot) const {
+	// Only the default shader knows about the extra slots, and MSDF/LCD rects sample the main texture directly.
+	if (p_current_batch->command_type != Item::Command::TYPE_RECT || p_current_batch->material_data != nullptr || p_current_batch->has_blend) {
+		return false;
+	}
+	if (p_state.other != p_current_batch->tex_info.state.other || p_state.texture_is_data()) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < p_current_batch->extra_texture_count; i++) {
+		if (p_current_batch->extra_textures[i].state == p_state) {
+			r_slot = i + 1;
+			return true;
+		}
+	}
+
+	if (p_current_batch->extra_texture_count == MAX_BATCH_TEXTURE_SLOTS - 1) {
+		return false;
+	}
+
+	TextureInfo info;
+	info.state = p_state;
+	_prepare_texture_info(&info, p_state.texture);
+
+	// Everything but the color texture is shared by the whole batch.
+	const TextureInfo &base = p_current_batch->tex_info;
+	if (info.normal != base.normal || info.specular != base.specular || info.sampler != base.sampler || info.specular_shininess != base.specular_shininess || info.flags != base.flags) {
+		return false;
+	}
+
+	BatchTextureSlot &slot = p_current_batch->extra_textures[p_current_batch->extra_texture_count];
+	slot.state = p_state;
+	slot.diffuse = info.diffuse;
+	slot.texpixel_size = info.texpixel_size;
+	p_current_batch->extra_texture_count++;
+	r_slot = p_current_batch->extra_texture_count;
+	return true;
 }
 
 RendererCanvasRenderRD::~RendererCanvasRenderRD() {
@@ -83,6 +83,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		FLAGS_NINEPATCH_H_MODE_SHIFT = 16,
 		FLAGS_NINEPATCH_V_MODE_SHIFT = 18,
 		FLAGS_LIGHT_COUNT_SHIFT = 20,
+		FLAGS_TEXTURE_SLOT_SHIFT = 24,
 
 		FLAGS_DEFAULT_NORMAL_MAP_USED = (1 << 26),
 		FLAGS_DEFAULT_SPECULAR_MAP_USED = (1 << 27),
@@ -434,6 +435,16 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID sampler;
 	};
 
+	// Rect batches using the default shader can sample from this many color textures (tex_info being the first),
+	// as long as everything else (sampler, normal and specular maps) matches.
+	static const uint32_t MAX_BATCH_TEXTURE_SLOTS = 4;
+
+	struct BatchTextureSlot {
+		TextureState state;
+		RID diffuse;
+		Vector2 texpixel_size;
+	};
+
 	struct Batch {
 		// Position in the UBO measured in bytes
 		uint32_t start = 0;
@@ -442,6 +453,9 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		TextureInfo tex_info;
 
+		uint32_t extra_texture_count = 0;
+		BatchTextureSlot extra_textures[MAX_BATCH_TEXTURE_SLOTS - 1];
+
 		Color modulate = Color(1.0, 1.0, 1.0, 1.0);
 
 		Item *clip = nullptr;
@@ -556,6 +570,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	void _record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch);
 	void _render_batch(RD::DrawListID p_draw_list, PipelineVariants *p_pipeline_variants, RenderingDevice::FramebufferFormatID p_framebuffer_format, Light *p_lights, Batch const *p_batch, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _prepare_batch_texture_info(Batch *p_current_batch, RID p_texture) const;
+	void _prepare_texture_info(TextureInfo *r_info, RID p_texture) const;
+	bool _add_batch_texture_slot(Batch *p_current_batch, const TextureState &p_state, uint32_t &r_slot) const;
 	[[nodiscard]] Batch *_new_batch(bool &r_batch_broken);
 	void _add_to_batch(uint32_t &r_index, bool &r_batch_broken, Batch *&r_current_batch);
 	void _allocate_instance_buffer();
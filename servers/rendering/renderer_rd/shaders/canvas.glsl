@@ -530,7 +530,16 @@ void main() {
 #else
 	{
 #endif
-		color *= texture(sampler2D(color_texture, texture_sampler), uv);
+		uint texture_slot = bitfieldExtract(draw_data.flags, FLAGS_TEXTURE_SLOT_SHIFT, 2);
+		if (texture_slot == 0) {
+			color *= texture(sampler2D(color_texture, texture_sampler), uv);
+		} else if (texture_slot == 1) {
+			color *= texture(sampler2D(color_texture_1, texture_sampler), uv);
+		} else if (texture_slot == 2) {
+			color *= texture(sampler2D(color_texture_2, texture_sampler), uv);
+		} else {
+			color *= texture(sampler2D(color_texture_3, texture_sampler), uv);
+		}
 	}
 
 	uint light_count = bitfieldExtract(draw_data.flags, FLAGS_LIGHT_COUNT_SHIFT, 4); //max 16 lights
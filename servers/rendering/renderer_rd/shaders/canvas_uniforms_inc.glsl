@@ -23,6 +23,8 @@
 
 #define FLAGS_LIGHT_COUNT_SHIFT 20
 
+#define FLAGS_TEXTURE_SLOT_SHIFT 24
+
 #define FLAGS_DEFAULT_NORMAL_MAP_USED (1 << 26)
 #define FLAGS_DEFAULT_SPECULAR_MAP_USED (1 << 27)
 
@@ -163,3 +165,8 @@ layout(set = 3, binding = 4, std430) restrict readonly buffer DrawData {
 	InstanceData data[];
 }
 instances;
+
+// Rect batches can mix up to four color textures, selected per instance with FLAGS_TEXTURE_SLOT_SHIFT.
+layout(set = 3, binding = 5) uniform texture2D color_texture_1;
+layout(set = 3, binding = 6) uniform texture2D color_texture_2;
+layout(set = 3, binding = 7) uniform texture2D color_texture_3;
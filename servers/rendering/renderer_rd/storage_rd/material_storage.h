@@ -71,6 +71,7 @@ public:
 		virtual bool is_animated() const = 0;
 		virtual bool casts_shadows() const = 0;
 		virtual RS::ShaderNativeSourceCode get_native_source_code() const { return RS::ShaderNativeSourceCode(); }
+		virtual void warm_up_pipelines() {}
 
 		virtual ~ShaderData() {}
 	};
@@ -406,6 +407,7 @@ public:
 	void shader_set_data_request_function(ShaderType p_shader_type, ShaderDataRequestFunction p_function);
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override;
+	virtual void shader_warm_up_pipelines(RID p_shader) override;
 
 	/* MATERIAL API */
 
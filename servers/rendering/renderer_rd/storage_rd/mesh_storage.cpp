@@ -30,6 +30,9 @@
 
 #include "mesh_storage.h"
 
+#include "core/templates/hash_map.h"
+#include "core/templates/pair.h"
+
 using namespace RendererRD;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -1044,6 +1047,16 @@ void MeshStorage::update_mesh_instances() {
 	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
+	// Instances that skin the same surface with the same 3D skeleton and have no blend shapes produce identical
+	// vertex data, so only the first one is dispatched and the rest copy its result once the compute list is done.
+	HashMap<Pair<const Mesh::Surface *, RID>, RID, PairHash<const Mesh::Surface *, RID>> shared_skinning_results;
+	struct SkinningCopy {
+		RID source;
+		RID destination;
+		uint32_t size = 0;
+	};
+	LocalVector<SkinningCopy> skinning_copies;
+
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
 
@@ -1079,6 +1092,21 @@ void MeshStorage::update_mesh_instances() {
 
 			bool array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
 
+			if (sk && !sk->use_2d && !array_is_2d && mi->mesh->blend_shape_count == 0) {
+				Pair<const Mesh::Surface *, RID> key(mi->mesh->surfaces[i], mi->skeleton);
+				RID vertex_buffer = mi->surfaces[i].vertex_buffer[mi->surfaces[i].current_buffer];
+				HashMap<Pair<const Mesh::Surface *, RID>, RID, PairHash<const Mesh::Surface *, RID>>::Iterator E = shared_skinning_results.find(key);
+				if (E) {
+					SkinningCopy copy;
+					copy.source = E->value;
+					copy.destination = vertex_buffer;
+					copy.size = mi->mesh->surfaces[i]->vertex_buffer_size;
+					skinning_copies.push_back(copy);
+					continue;
+				}
+				shared_skinning_results.insert(key, vertex_buffer);
+			}
+
 			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
 
 			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi_surface_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
@@ -1140,6 +1168,10 @@ void MeshStorage::update_mesh_instances() {
 	}
 
 	RD::get_singleton()->compute_list_end();
+
+	for (const SkinningCopy &copy : skinning_copies) {
+		RD::get_singleton()->buffer_copy(copy.source, copy.destination, 0, 0, copy.size);
+	}
 }
 
 void MeshStorage::_mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint64_t p_input_mask, bool p_input_motion_vectors, MeshInstance::Surface *mis, uint32_t p_current_buffer, uint32_t p_previous_buffer) {
@@ -1978,6 +2010,39 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride_cache == 0);
+	ERR_FAIL_COND(p_buffer.size() % multimesh->stride_cache != 0);
+	int count = p_buffer.size() / multimesh->stride_cache;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + count > multimesh->instances);
+	if (count == 0) {
+		return;
+	}
+
+	// Goes through the data cache like the per-instance setters, so only the dirty regions get uploaded.
+	_multimesh_make_local(multimesh);
+
+	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+	if (uses_motion_vectors) {
+		_multimesh_enable_motion_vectors(multimesh);
+	}
+
+	_multimesh_update_motion_vectors_data_cache(multimesh);
+
+	{
+		float *w = multimesh->data_cache.ptrw();
+		memcpy(w + (multimesh->motion_vectors_current_offset + p_first_instance) * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+	}
+
+	uint32_t first_region = p_first_instance / MULTIMESH_DIRTY_REGION_SIZE;
+	uint32_t last_region = (p_first_instance + count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+	for (uint32_t i = first_region; i <= last_region; i++) {
+		_multimesh_mark_dirty(multimesh, i * MULTIMESH_DIRTY_REGION_SIZE, true);
+	}
+}
+
 Vector<float> MeshStorage::_multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
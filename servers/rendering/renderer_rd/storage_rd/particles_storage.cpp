@@ -264,6 +264,8 @@ bool ParticlesStorage::particles_get_emitting(RID p_particles) {
 }
 
 void ParticlesStorage::_particles_free_data(Particles *particles) {
+	particles->view_axis_copy_valid = false;
+
 	if (particles->particle_buffer.is_valid()) {
 		RD::get_singleton()->free(particles->particle_buffer);
 		particles->particle_buffer = RID();
@@ -472,6 +474,7 @@ void ParticlesStorage::particles_set_transform_align(RID p_particles, RS::Partic
 	ERR_FAIL_NULL(particles);
 
 	particles->transform_align = p_transform_align;
+	particles->view_axis_copy_valid = false;
 }
 
 void ParticlesStorage::particles_set_process_material(RID p_particles, RID p_material) {
@@ -494,6 +497,7 @@ void ParticlesStorage::particles_set_draw_order(RID p_particles, RS::ParticlesDr
 	ERR_FAIL_NULL(particles);
 
 	particles->draw_order = p_order;
+	particles->view_axis_copy_valid = false;
 }
 
 void ParticlesStorage::particles_set_draw_passes(RID p_particles, int p_passes) {
@@ -1192,6 +1196,19 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 		return; //particles have not processed yet
 	}
 
+	Vector3 axis = -p_axis; // cameras look to z negative
+
+	if (particles->use_local_coords) {
+		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
+	}
+
+	if (particles->view_axis_copy_valid && particles->view_axis_copy_axis == axis && particles->view_axis_copy_up_axis == p_up_axis) {
+		return; // Nothing changed since the last copy, e.g. the particles are inactive.
+	}
+	particles->view_axis_copy_valid = true;
+	particles->view_axis_copy_axis = axis;
+	particles->view_axis_copy_up_axis = p_up_axis;
+
 	bool do_sort = particles->draw_order == RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH;
 
 	//copy to sort buffer
@@ -1244,12 +1261,6 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 	copy_push_constant.total_particles = particles->amount;
 	copy_push_constant.copy_mode_2d = false;
 
-	Vector3 axis = -p_axis; // cameras look to z negative
-
-	if (particles->use_local_coords) {
-		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
-	}
-
 	copy_push_constant.sort_direction[0] = axis.x;
 	copy_push_constant.sort_direction[1] = axis.y;
 	copy_push_constant.sort_direction[2] = axis.z;
@@ -1328,6 +1339,8 @@ void ParticlesStorage::_particles_update_buffers(Particles *particles) {
 		return;
 	}
 
+	particles->view_axis_copy_valid = false;
+
 	if (particles->amount > 0) {
 		int total_amount = particles->amount;
 		if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
@@ -1556,6 +1569,7 @@ void ParticlesStorage::update_particles() {
 
 		// Ensure that memory is initialized (the code above should ensure that _particles_process is always called at least once upon clearing).
 		DEV_ASSERT(!particles->clear);
+		particles->view_axis_copy_valid = false;
 
 		int total_amount = particles->amount;
 		if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
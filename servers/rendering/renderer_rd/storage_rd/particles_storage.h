@@ -208,6 +208,12 @@ private:
 		RID particles_sort_buffer;
 		RID particles_sort_uniform_set;
 
+		// The view-dependent copy (and sort) only needs to run again if the particles
+		// were processed, their buffers changed or the view axis moved.
+		bool view_axis_copy_valid = false;
+		Vector3 view_axis_copy_axis;
+		Vector3 view_axis_copy_up_axis;
+
 		bool dirty = false;
 		SelfList<Particles> update_list;
 
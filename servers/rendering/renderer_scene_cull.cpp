@@ -39,11 +39,109 @@
 
 #include <new>
 
+#if defined(__SSE2__) && !defined(REAL_T_IS_DOUBLE)
+#include <emmintrin.h>
+#define SCENE_CULL_SIMD_SSE2
+#elif defined(__ARM_NEON) && !defined(REAL_T_IS_DOUBLE)
+#include <arm_neon.h>
+#define SCENE_CULL_SIMD_NEON
+#endif
+
 #if defined(DEBUG_ENABLED) && defined(TOOLS_ENABLED)
 // This is used only to obtain node paths for user-friendly physics interpolation warnings.
 #include "scene/main/node.h"
 #endif
 
+/* FRUSTUM CULLING */
+
+// Tests up to 64 consecutive instance bounds against a frustum and returns a bit mask
+// of the ones that pass, using the same test as InstanceBounds::in_frustum().
+// Four bounds are tested per iteration when SIMD is available.
+static uint64_t _frustum_cull_block(const PagedArray<RendererSceneCull::InstanceBounds> &p_bounds, uint64_t p_from, uint32_t p_count, const RendererSceneCull::Frustum &p_frustum) {
+	DEV_ASSERT(p_count <= 64);
+
+	uint64_t mask = 0;
+	uint32_t i = 0;
+
+#if defined(SCENE_CULL_SIMD_SSE2) || defined(SCENE_CULL_SIMD_NEON)
+	for (; i + 4 <= p_count; i += 4) {
+		const real_t *b0 = p_bounds[p_from + i + 0].bounds;
+		const real_t *b1 = p_bounds[p_from + i + 1].bounds;
+		const real_t *b2 = p_bounds[p_from + i + 2].bounds;
+		const real_t *b3 = p_bounds[p_from + i + 3].bounds;
+
+#ifdef SCENE_CULL_SIMD_SSE2
+		// Transpose the four AABBs so each register holds one bound component.
+		__m128 soa[6];
+		for (uint32_t c = 0; c < 6; c++) {
+			soa[c] = _mm_setr_ps(b0[c], b1[c], b2[c], b3[c]);
+		}
+
+		__m128 outside = _mm_setzero_ps();
+		for (uint32_t j = 0; j < p_frustum.plane_count; j++) {
+			const Plane &plane = p_frustum.planes_ptr[j];
+			const uint32_t *signs = p_frustum.plane_signs_ptr[j].signs;
+			__m128 dist = _mm_mul_ps(_mm_set1_ps(plane.normal.x), soa[signs[0]]);
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(plane.normal.y), soa[signs[1]]));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(plane.normal.z), soa[signs[2]]));
+			dist = _mm_sub_ps(dist, _mm_set1_ps(plane.d));
+			outside = _mm_or_ps(outside, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+			if (_mm_movemask_ps(outside) == 0xF) {
+				break;
+			}
+		}
+
+		mask |= uint64_t(~_mm_movemask_ps(outside) & 0xF) << i;
+#else
+		float32x4_t soa[6];
+		for (uint32_t c = 0; c < 6; c++) {
+			const float lanes[4] = { b0[c], b1[c], b2[c], b3[c] };
+			soa[c] = vld1q_f32(lanes);
+		}
+
+		uint32x4_t outside = vdupq_n_u32(0);
+		for (uint32_t j = 0; j < p_frustum.plane_count; j++) {
+			const Plane &plane = p_frustum.planes_ptr[j];
+			const uint32_t *signs = p_frustum.plane_signs_ptr[j].signs;
+			float32x4_t dist = vmulq_n_f32(soa[signs[0]], plane.normal.x);
+			dist = vaddq_f32(dist, vmulq_n_f32(soa[signs[1]], plane.normal.y));
+			dist = vaddq_f32(dist, vmulq_n_f32(soa[signs[2]], plane.normal.z));
+			dist = vsubq_f32(dist, vdupq_n_f32(plane.d));
+			outside = vorrq_u32(outside, vcgeq_f32(dist, vdupq_n_f32(0.0f)));
+			uint32x2_t half = vand_u32(vget_low_u32(outside), vget_high_u32(outside));
+			if ((vget_lane_u32(half, 0) & vget_lane_u32(half, 1)) != 0) {
+				break;
+			}
+		}
+
+		uint64_t inside = 0;
+		inside |= vgetq_lane_u32(outside, 0) ? 0 : 1;
+		inside |= vgetq_lane_u32(outside, 1) ? 0 : 2;
+		inside |= vgetq_lane_u32(outside, 2) ? 0 : 4;
+		inside |= vgetq_lane_u32(outside, 3) ? 0 : 8;
+		mask |= inside << i;
+#endif
+	}
+#endif // SCENE_CULL_SIMD_SSE2 || SCENE_CULL_SIMD_NEON
+
+	for (; i < p_count; i++) {
+		if (p_bounds[p_from + i].in_frustum(p_frustum)) {
+			mask |= uint64_t(1) << i;
+		}
+	}
+
+	return mask;
+}
+
+// Same as _frustum_cull_block(), but computes the mask in r_masks[p_index] only once per block.
+static _FORCE_INLINE_ uint64_t _frustum_cull_block_cached(const PagedArray<RendererSceneCull::InstanceBounds> &p_bounds, uint64_t p_from, uint32_t p_count, const RendererSceneCull::Frustum &p_frustum, uint32_t p_index, uint64_t *r_masks, uint32_t &r_valid) {
+	if (!(r_valid & (1u << p_index))) {
+		r_masks[p_index] = _frustum_cull_block(p_bounds, p_from, p_count, p_frustum);
+		r_valid |= 1u << p_index;
+	}
+	return r_masks[p_index];
+}
+
 /* HALTON SEQUENCE */
 
 #ifndef _3D_DISABLED
@@ -1038,6 +1136,59 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 #endif
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	const int count = p_instances.size();
+
+	// Set every transform first, then queue the changed instances in one go.
+	// Their AABBs and BVH entries are then updated together by update_dirty_instances().
+	LocalVector<Instance *> changed;
+	changed.reserve(count);
+	for (int i = 0; i < count; i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		if (_interpolation_data.interpolation_enabled && instance->interpolated && instance->scenario) {
+			// Interpolated instances also need to go on the interpolation lists.
+			instance_set_transform(instances[i], transforms[i]);
+			continue;
+		}
+
+		const Transform3D &transform = transforms[i];
+		if (instance->transform == transform) {
+			continue; // Must be checked to avoid worst evil.
+		}
+
+#ifdef DEBUG_ENABLED
+		bool finite = true;
+		for (int j = 0; j < 4; j++) {
+			const Vector3 &v = j < 3 ? transform.basis.rows[j] : transform.origin;
+			if (!v.is_finite()) {
+				finite = false;
+				break;
+			}
+		}
+		ERR_CONTINUE(!finite);
+#endif
+
+		instance->transform = transform;
+		changed.push_back(instance);
+
+#if defined(DEBUG_ENABLED) && defined(TOOLS_ENABLED)
+		if (_interpolation_data.interpolation_enabled && !instance->interpolated && Engine::get_singleton()->is_in_physics_frame()) {
+			PHYSICS_INTERPOLATION_NODE_WARNING(instance->object_id, "Non-interpolated instance triggered from physics process");
+		}
+#endif
+	}
+
+	for (Instance *instance : changed) {
+		_instance_queue_update(instance, true);
+	}
+}
+
 void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -2915,23 +3066,39 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	// Frustum tests are done ahead of time for blocks of instances, so the bounds can be tested in batches.
+	// Shadow cascade masks are only computed for a block once an instance in it needs them.
+	uint64_t block_from = p_from;
+	uint64_t camera_frustum_mask = 0;
+	uint64_t shadow_frustum_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+	uint32_t shadow_frustum_masks_valid = 0;
+	static_assert(RendererSceneRender::MAX_DIRECTIONAL_LIGHTS * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES <= 32);
+
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
 
+		if (i == block_from || i - block_from == 64) {
+			block_from = i;
+			camera_frustum_mask = _frustum_cull_block(cull_data.scenario->instance_aabbs, block_from, MIN(p_to - block_from, (uint64_t)64), cull_data.cull->frustum);
+			shadow_frustum_masks_valid = 0;
+		}
+		const uint64_t block_bit = uint64_t(1) << (i - block_from);
+
 		InstanceData &idata = cull_data.scenario->instance_data[i];
 		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 		int32_t visibility_check = -1;
 
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
-#define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_CAMERA_FRUSTUM (camera_frustum_mask & block_bit)
+#define IN_SHADOW_FRUSTUM(m_shadow, m_cascade) (_frustum_cull_block_cached(cull_data.scenario->instance_aabbs, block_from, MIN(p_to - block_from, (uint64_t)64), cull_data.cull->shadows[m_shadow].cascades[m_cascade].frustum, m_shadow * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES + m_cascade, shadow_frustum_masks, shadow_frustum_masks_valid) & block_bit)
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_CAMERA_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3126,7 +3293,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					continue;
 				}
 				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
+					if (IN_SHADOW_FRUSTUM(j, k) && VIS_CHECK) {
 						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && LAYER_CHECK) {
@@ -3140,7 +3307,8 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
-#undef IN_FRUSTUM
+#undef IN_CAMERA_FRUSTUM
+#undef IN_SHADOW_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
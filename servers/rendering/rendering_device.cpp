@@ -117,12 +117,6 @@ static uint32_t _get_device_type_score(const RenderingContextDriver::Device &p_d
 
 #define RENDER_GRAPH_FULL_BARRIERS 0
 
-// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
-// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
-// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
-
-#define SECONDARY_COMMAND_BUFFERS_PER_FRAME 0
-
 RenderingDevice *RenderingDevice::singleton = nullptr;
 
 RenderingDevice *RenderingDevice::get_singleton() {
@@ -2244,6 +2238,8 @@ RenderingDevice::FramebufferFormatID RenderingDevice::framebuffer_format_create_
 }
 
 RenderingDevice::TextureSamples RenderingDevice::framebuffer_format_get_texture_samples(FramebufferFormatID p_format, uint32_t p_pass) {
+	_THREAD_SAFE_METHOD_
+
 	HashMap<FramebufferFormatID, FramebufferFormat>::Iterator E = framebuffer_formats.find(p_format);
 	ERR_FAIL_COND_V(!E, TEXTURE_SAMPLES_1);
 	ERR_FAIL_COND_V(p_pass >= uint32_t(E->value.pass_samples.size()), TEXTURE_SAMPLES_1);
@@ -3320,20 +3316,54 @@ RID RenderingDevice::render_pipeline_create(RID p_shader, FramebufferFormatID p_
 	}
 
 	RenderPipeline pipeline;
-	pipeline.driver_id = driver->render_pipeline_create(
-			shader->driver_id,
-			driver_vertex_format,
-			p_render_primitive,
-			p_rasterization_state,
-			p_multisample_state,
-			p_depth_stencil_state,
-			p_blend_state,
-			pass.color_attachments,
-			p_dynamic_state_flags,
-			fb_format.render_pass,
-			p_for_render_pass,
-			p_specialization_constants);
-	ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+	if (concurrent_pipeline_creation) {
+		// Compiling can take a long time, so let other threads use the device meanwhile
+		// (e.g. the render thread while pipelines are compiled in the background).
+		RDD::ShaderID shader_driver_id = shader->driver_id;
+		Vector<int32_t> color_attachments = pass.color_attachments;
+		RDD::RenderPassID render_pass = fb_format.render_pass;
+
+		pipeline_compilation_rw_lock.read_lock();
+		_thread_safe_method_.temp_unlock();
+		pipeline.driver_id = driver->render_pipeline_create(
+				shader_driver_id,
+				driver_vertex_format,
+				p_render_primitive,
+				p_rasterization_state,
+				p_multisample_state,
+				p_depth_stencil_state,
+				p_blend_state,
+				color_attachments,
+				p_dynamic_state_flags,
+				render_pass,
+				p_for_render_pass,
+				p_specialization_constants);
+		pipeline_compilation_rw_lock.read_unlock();
+		_thread_safe_method_.temp_relock();
+		ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+
+		shader = shader_owner.get_or_null(p_shader);
+		if (!shader) {
+			// Freed while compiling.
+			driver->pipeline_free(pipeline.driver_id);
+			return RID();
+		}
+	} else {
+		pipeline.driver_id = driver->render_pipeline_create(
+				shader->driver_id,
+				driver_vertex_format,
+				p_render_primitive,
+				p_rasterization_state,
+				p_multisample_state,
+				p_depth_stencil_state,
+				p_blend_state,
+				pass.color_attachments,
+				p_dynamic_state_flags,
+				fb_format.render_pass,
+				p_for_render_pass,
+				p_specialization_constants);
+		ERR_FAIL_COND_V(!pipeline.driver_id, RID());
+	}
 
 	if (pipeline_cache_enabled) {
 		_update_pipeline_cache();
@@ -5128,12 +5158,15 @@ void RenderingDevice::_free_pending_resources(int p_frame) {
 	}
 
 	// Shaders.
-	while (frames[p_frame].shaders_to_dispose_of.front()) {
-		Shader *shader = &frames[p_frame].shaders_to_dispose_of.front()->get();
+	if (frames[p_frame].shaders_to_dispose_of.front()) {
+		RWLockWrite rw_lock(pipeline_compilation_rw_lock);
+		while (frames[p_frame].shaders_to_dispose_of.front()) {
+			Shader *shader = &frames[p_frame].shaders_to_dispose_of.front()->get();
 
-		driver->shader_free(shader->driver_id);
+			driver->shader_free(shader->driver_id);
 
-		frames[p_frame].shaders_to_dispose_of.pop_front();
+			frames[p_frame].shaders_to_dispose_of.pop_front();
+		}
 	}
 
 	// Samplers.
@@ -5486,7 +5519,11 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->command_buffer_begin(frames[0].draw_command_buffer);
 
 	// Create draw graph and start it initialized as well.
-	draw_graph.initialize(driver, device, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
+	// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
+	// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
+	// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
+	uint32_t secondary_command_buffers_per_frame = GLOBAL_GET("rendering/rendering_device/secondary_command_buffers_per_frame");
+	draw_graph.initialize(driver, device, frames.size(), main_queue_family, secondary_command_buffers_per_frame);
 	draw_graph.begin();
 
 	for (uint32_t i = 0; i < frames.size(); i++) {
@@ -5525,6 +5562,8 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	draw_list = nullptr;
 	compute_list = nullptr;
 
+	concurrent_pipeline_creation = driver->api_trait_get(RDD::API_TRAIT_CONCURRENT_PIPELINE_CREATION);
+
 	bool project_pipeline_cache_enable = GLOBAL_GET("rendering/rendering_device/pipeline_cache/enable");
 	if (is_main_instance && project_pipeline_cache_enable) {
 		// Only the instance that is not a local device and is also the singleton is allowed to manage a pipeline cache.
@@ -33,6 +33,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/rw_lock.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
@@ -1026,6 +1027,11 @@ private:
 
 	RID_Owner<RenderPipeline> render_pipeline_owner;
 
+	// Held for reading while the driver creates a pipeline outside of the main lock, and for writing
+	// while disposing of shaders, so a shader can't be freed from under a pipeline being compiled.
+	RWLock pipeline_compilation_rw_lock;
+	bool concurrent_pipeline_creation = false;
+
 	bool pipeline_cache_enabled = false;
 	size_t pipeline_cache_size = 0;
 	String pipeline_cache_file_path;
@@ -754,6 +754,196 @@ void RenderingDeviceGraph::_run_secondary_command_buffer_task(const SecondaryCom
 	driver->command_buffer_end(p_secondary->command_buffer);
 }
 
+uint32_t RenderingDeviceGraph::_get_draw_list_instruction_size(const DrawListInstruction *p_instruction) {
+	switch (p_instruction->type) {
+		case DrawListInstruction::TYPE_BIND_INDEX_BUFFER:
+			return sizeof(DrawListBindIndexBufferInstruction);
+		case DrawListInstruction::TYPE_BIND_PIPELINE:
+			return sizeof(DrawListBindPipelineInstruction);
+		case DrawListInstruction::TYPE_BIND_UNIFORM_SET:
+			return sizeof(DrawListBindUniformSetInstruction);
+		case DrawListInstruction::TYPE_BIND_VERTEX_BUFFERS: {
+			const DrawListBindVertexBuffersInstruction *bind_vertex_buffers_instruction = reinterpret_cast<const DrawListBindVertexBuffersInstruction *>(p_instruction);
+			return sizeof(DrawListBindVertexBuffersInstruction) + (sizeof(RDD::BufferID) + sizeof(uint64_t)) * bind_vertex_buffers_instruction->vertex_buffers_count;
+		}
+		case DrawListInstruction::TYPE_CLEAR_ATTACHMENTS: {
+			const DrawListClearAttachmentsInstruction *clear_attachments_instruction = reinterpret_cast<const DrawListClearAttachmentsInstruction *>(p_instruction);
+			return sizeof(DrawListClearAttachmentsInstruction) + sizeof(RDD::AttachmentClear) * clear_attachments_instruction->attachments_clear_count + sizeof(Rect2i) * clear_attachments_instruction->attachments_clear_rect_count;
+		}
+		case DrawListInstruction::TYPE_DRAW:
+			return sizeof(DrawListDrawInstruction);
+		case DrawListInstruction::TYPE_DRAW_INDEXED:
+			return sizeof(DrawListDrawIndexedInstruction);
+		case DrawListInstruction::TYPE_EXECUTE_COMMANDS:
+			return sizeof(DrawListExecuteCommandsInstruction);
+		case DrawListInstruction::TYPE_NEXT_SUBPASS:
+			return sizeof(DrawListNextSubpassInstruction);
+		case DrawListInstruction::TYPE_SET_BLEND_CONSTANTS:
+			return sizeof(DrawListSetBlendConstantsInstruction);
+		case DrawListInstruction::TYPE_SET_LINE_WIDTH:
+			return sizeof(DrawListSetLineWidthInstruction);
+		case DrawListInstruction::TYPE_SET_PUSH_CONSTANT: {
+			const DrawListSetPushConstantInstruction *set_push_constant_instruction = reinterpret_cast<const DrawListSetPushConstantInstruction *>(p_instruction);
+			return sizeof(DrawListSetPushConstantInstruction) + set_push_constant_instruction->size;
+		}
+		case DrawListInstruction::TYPE_SET_SCISSOR:
+			return sizeof(DrawListSetScissorInstruction);
+		case DrawListInstruction::TYPE_SET_VIEWPORT:
+			return sizeof(DrawListSetViewportInstruction);
+		case DrawListInstruction::TYPE_UNIFORM_SET_PREPARE_FOR_USE:
+			return sizeof(DrawListUniformSetPrepareForUseInstruction);
+		default:
+			DEV_ASSERT(false && "Unknown draw list instruction type.");
+			return 0;
+	}
+}
+
+void RenderingDeviceGraph::_record_draw_list_in_secondary_command_buffers(uint32_t p_max_splits) {
+	const uint8_t *instruction_data = draw_instruction_list.data.ptr();
+	const uint32_t instruction_data_size = draw_instruction_list.data.size();
+
+	// Subpass changes can't be split, as every secondary command buffer is started on the first subpass.
+	uint32_t max_splits = p_max_splits;
+	for (uint32_t cursor = 0; cursor < instruction_data_size && max_splits > 1;) {
+		const DrawListInstruction *instruction = reinterpret_cast<const DrawListInstruction *>(&instruction_data[cursor]);
+		if (instruction->type == DrawListInstruction::TYPE_NEXT_SUBPASS || instruction->type == DrawListInstruction::TYPE_EXECUTE_COMMANDS) {
+			max_splits = 1;
+		}
+		uint32_t instruction_size = _get_draw_list_instruction_size(instruction);
+		ERR_FAIL_COND(instruction_size == 0);
+		cursor += instruction_size;
+	}
+
+	// Each split after the first one must start by restoring the state the previous splits left bound. The offset of the
+	// last instruction that set each piece of state is tracked, and those instructions are copied in front of the split.
+	enum {
+		STATE_PIPELINE,
+		STATE_INDEX_BUFFER,
+		STATE_VERTEX_BUFFERS,
+		STATE_PUSH_CONSTANT,
+		STATE_VIEWPORT,
+		STATE_SCISSOR,
+		STATE_BLEND_CONSTANTS,
+		STATE_LINE_WIDTH,
+		STATE_MAX
+	};
+
+	int32_t state_offsets[STATE_MAX];
+	for (uint32_t i = 0; i < STATE_MAX; i++) {
+		state_offsets[i] = -1;
+	}
+
+	LocalVector<int32_t> uniform_set_offsets;
+	LocalVector<int32_t> uniform_set_prepare_offsets;
+	LocalVector<int32_t> restore_offsets;
+
+	const uint32_t split_size_target = instruction_data_size / max_splits;
+	uint32_t split_begin = 0;
+	uint32_t split_count = 0;
+	uint32_t cursor = 0;
+	while (split_begin < instruction_data_size) {
+		SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[frames[frame].secondary_command_buffers_used];
+		secondary.render_pass = draw_instruction_list.render_pass;
+		secondary.framebuffer = draw_instruction_list.framebuffer;
+		secondary.instruction_data.clear();
+
+		// Restore the bound state, in the same order it was originally set.
+		restore_offsets.clear();
+		for (uint32_t i = 0; i < STATE_MAX; i++) {
+			if (state_offsets[i] >= 0) {
+				restore_offsets.push_back(state_offsets[i]);
+			}
+		}
+		for (uint32_t i = 0; i < uniform_set_offsets.size(); i++) {
+			if (uniform_set_prepare_offsets[i] >= 0) {
+				restore_offsets.push_back(uniform_set_prepare_offsets[i]);
+			}
+			if (uniform_set_offsets[i] >= 0) {
+				restore_offsets.push_back(uniform_set_offsets[i]);
+			}
+		}
+		restore_offsets.sort();
+
+		for (int32_t offset : restore_offsets) {
+			uint32_t instruction_size = _get_draw_list_instruction_size(reinterpret_cast<const DrawListInstruction *>(&instruction_data[offset]));
+			uint32_t previous_size = secondary.instruction_data.size();
+			secondary.instruction_data.resize(previous_size + instruction_size);
+			memcpy(secondary.instruction_data.ptr() + previous_size, &instruction_data[offset], instruction_size);
+		}
+
+		// Advance until the split is large enough, only splitting right after a draw.
+		bool last_split = split_count + 1 >= max_splits;
+		while (cursor < instruction_data_size) {
+			const DrawListInstruction *instruction = reinterpret_cast<const DrawListInstruction *>(&instruction_data[cursor]);
+			uint32_t instruction_size = _get_draw_list_instruction_size(instruction);
+			switch (instruction->type) {
+				case DrawListInstruction::TYPE_BIND_PIPELINE: {
+					state_offsets[STATE_PIPELINE] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_BIND_INDEX_BUFFER: {
+					state_offsets[STATE_INDEX_BUFFER] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_BIND_VERTEX_BUFFERS: {
+					state_offsets[STATE_VERTEX_BUFFERS] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_SET_PUSH_CONSTANT: {
+					state_offsets[STATE_PUSH_CONSTANT] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_SET_VIEWPORT: {
+					state_offsets[STATE_VIEWPORT] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_SET_SCISSOR: {
+					state_offsets[STATE_SCISSOR] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_SET_BLEND_CONSTANTS: {
+					state_offsets[STATE_BLEND_CONSTANTS] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_SET_LINE_WIDTH: {
+					state_offsets[STATE_LINE_WIDTH] = cursor;
+				} break;
+				case DrawListInstruction::TYPE_BIND_UNIFORM_SET:
+				case DrawListInstruction::TYPE_UNIFORM_SET_PREPARE_FOR_USE: {
+					uint32_t set_index = instruction->type == DrawListInstruction::TYPE_BIND_UNIFORM_SET ? reinterpret_cast<const DrawListBindUniformSetInstruction *>(instruction)->set_index : reinterpret_cast<const DrawListUniformSetPrepareForUseInstruction *>(instruction)->set_index;
+					while (uniform_set_offsets.size() <= set_index) {
+						uniform_set_offsets.push_back(-1);
+						uniform_set_prepare_offsets.push_back(-1);
+					}
+					if (instruction->type == DrawListInstruction::TYPE_BIND_UNIFORM_SET) {
+						uniform_set_offsets[set_index] = cursor;
+					} else {
+						uniform_set_prepare_offsets[set_index] = cursor;
+					}
+				} break;
+				default: {
+				} break;
+			}
+
+			cursor += instruction_size;
+
+			bool is_draw = instruction->type == DrawListInstruction::TYPE_DRAW || instruction->type == DrawListInstruction::TYPE_DRAW_INDEXED;
+			if (!last_split && is_draw && (cursor - split_begin) >= split_size_target) {
+				break;
+			}
+		}
+
+		uint32_t previous_size = secondary.instruction_data.size();
+		secondary.instruction_data.resize(previous_size + cursor - split_begin);
+		memcpy(secondary.instruction_data.ptr() + previous_size, &instruction_data[split_begin], cursor - split_begin);
+		split_begin = cursor;
+
+		// Run a background task for recording the secondary command buffer.
+		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, &secondary, true);
+		frames[frame].secondary_command_buffers_used++;
+		split_count++;
+	}
+
+	// Clear the instruction list and add the commands for executing the secondary command buffers in order instead.
+	draw_instruction_list.data.clear();
+	for (uint32_t i = frames[frame].secondary_command_buffers_used - split_count; i < frames[frame].secondary_command_buffers_used; i++) {
+		add_draw_list_execute_commands(frames[frame].secondary_command_buffers[i].command_buffer);
+	}
+}
+
 void RenderingDeviceGraph::_wait_for_secondary_command_buffer_tasks() {
 	for (uint32_t i = 0; i < frames[frame].secondary_command_buffers_used; i++) {
 		WorkerThreadPool::TaskID &task = frames[frame].secondary_command_buffers[i].task;
@@ -1677,23 +1867,11 @@ void RenderingDeviceGraph::add_draw_list_end() {
 	// Arbitrary size threshold to evaluate if it'd be best to record the draw list on the background as a secondary buffer.
 	const uint32_t instruction_data_threshold_for_secondary = 16384;
 	RDD::CommandBufferType command_buffer_type;
-	uint32_t &secondary_buffers_used = frames[frame].secondary_command_buffers_used;
-	if (draw_instruction_list.data.size() > instruction_data_threshold_for_secondary && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
-		// Copy the current instruction list data into another array that will be used by the secondary command buffer worker.
-		SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[secondary_buffers_used];
-		secondary.render_pass = draw_instruction_list.render_pass;
-		secondary.framebuffer = draw_instruction_list.framebuffer;
-		secondary.instruction_data.resize(draw_instruction_list.data.size());
-		memcpy(secondary.instruction_data.ptr(), draw_instruction_list.data.ptr(), draw_instruction_list.data.size());
-
-		// Run a background task for recording the secondary command buffer.
-		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, &secondary, true);
-
-		// Clear the instruction list and add a single command for executing the secondary command buffer instead.
-		draw_instruction_list.data.clear();
-		add_draw_list_execute_commands(secondary.command_buffer);
-		secondary_buffers_used++;
-
+	uint32_t secondary_buffers_available = frames[frame].secondary_command_buffers.size() - frames[frame].secondary_command_buffers_used;
+	if (draw_instruction_list.data.size() > instruction_data_threshold_for_secondary && secondary_buffers_available > 0) {
+		// Large draw lists are split across as many secondary command buffers as their size allows, so they're recorded in parallel.
+		uint32_t max_splits = MIN(secondary_buffers_available, draw_instruction_list.data.size() / instruction_data_threshold_for_secondary);
+		_record_draw_list_in_secondary_command_buffers(MAX(max_splits, 1U));
 		command_buffer_type = RDD::COMMAND_BUFFER_TYPE_SECONDARY;
 	} else {
 		command_buffer_type = RDD::COMMAND_BUFFER_TYPE_PRIMARY;
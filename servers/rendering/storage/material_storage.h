@@ -70,6 +70,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_material, const StringName &p_param) const = 0;
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const = 0;
+	virtual void shader_warm_up_pipelines(RID p_shader) = 0;
 
 	/* MATERIAL API */
 
@@ -107,6 +107,23 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped buffer") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+
+	const uint8_t *mapped = f->get_mapped_buffer();
+	if (mapped == nullptr) {
+		// Not every platform backend supports mapping files.
+		return;
+	}
+
+	Vector<uint8_t> data;
+	data.resize(f->get_length());
+	CHECK(f->get_buffer(data.ptrw(), data.size()) == (uint64_t)data.size());
+	CHECK(memcmp(mapped, data.ptr(), data.size()) == 0);
+	CHECK_MESSAGE(f->get_mapped_buffer() == mapped, "Mapping the same open file again should return the same view.");
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
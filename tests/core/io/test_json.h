@@ -232,6 +232,41 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+TEST_CASE("[JSON] Stringify") {
+	Dictionary dict;
+	Array arr;
+	arr.push_back(1);
+	arr.push_back(2);
+	dict["b"] = arr;
+	dict["a"] = Variant();
+
+	CHECK(JSON::stringify(dict) == "{\"a\":null,\"b\":[1,2]}");
+	CHECK(JSON::stringify(dict, "\t") == "{\n\t\"a\": null,\n\t\"b\": [\n\t\t1,\n\t\t2\n\t]\n}");
+	CHECK(JSON::stringify(Array()) == "[]");
+
+	// Floats nested in arrays and dictionaries use the same precision as top-level ones.
+	const double value = 0.1;
+	const String default_precision = JSON::stringify(value);
+	const String full_precision = JSON::stringify(value, "", true, true);
+	CHECK(default_precision != full_precision);
+
+	Array nested;
+	nested.push_back(value);
+	Dictionary nested_dict;
+	nested_dict["f"] = nested;
+	CHECK(JSON::stringify(nested) == "[" + default_precision + "]");
+	CHECK_MESSAGE(
+			JSON::stringify(nested, "", true, true) == "[" + full_precision + "]",
+			"Full precision should also apply to nested values.");
+	CHECK(JSON::stringify(nested_dict) == "{\"f\":[" + default_precision + "]}");
+	CHECK_MESSAGE(
+			JSON::stringify(nested_dict, "", true, true) == "{\"f\":[" + full_precision + "]}",
+			"Full precision should also apply to values nested in dictionaries.");
+
+	const Array decoded = JSON::parse_string(JSON::stringify(nested, "", true, true));
+	CHECK_MESSAGE(double(decoded[0]) == value, "Nested full precision floats should decode exactly.");
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
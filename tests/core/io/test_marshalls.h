@@ -386,6 +386,57 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed scalar arrays encoding") {
+	PackedInt32Array int32_array = { 1, -2, 0x12345678 };
+	int r_len;
+
+	CHECK(encode_variant(int32_array, nullptr, r_len) == OK);
+	CHECK(r_len == 20);
+
+	uint8_t int32_buffer[20];
+	CHECK(encode_variant(int32_array, int32_buffer, r_len) == OK);
+	CHECK(r_len == 20);
+	// Check array size.
+	CHECK(int32_buffer[4] == 0x03);
+	CHECK(int32_buffer[5] == 0x00);
+	CHECK(int32_buffer[6] == 0x00);
+	CHECK(int32_buffer[7] == 0x00);
+	// Check elements are little-endian.
+	CHECK(int32_buffer[8] == 0x01);
+	CHECK(int32_buffer[12] == 0xfe);
+	CHECK(int32_buffer[15] == 0xff);
+	CHECK(int32_buffer[16] == 0x78);
+	CHECK(int32_buffer[17] == 0x56);
+	CHECK(int32_buffer[18] == 0x34);
+	CHECK(int32_buffer[19] == 0x12);
+}
+
+TEST_CASE("[Marshalls] Packed scalar arrays round trip") {
+	const Variant arrays[] = {
+		PackedByteArray({ 1, 2, 3, 4, 5 }),
+		PackedInt32Array({ 1, -2, 0x12345678 }),
+		PackedInt64Array({ 1, -2, 0x123456789abcdef }),
+		PackedFloat32Array({ 1.5f, -2.25f, 1e10f }),
+		PackedFloat64Array({ 1.5, -2.25, 1e300 }),
+	};
+
+	for (const Variant &array : arrays) {
+		int len;
+		CHECK(encode_variant(array, nullptr, len) == OK);
+
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		CHECK(encode_variant(array, buffer.ptrw(), len) == OK);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), len, &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK(decoded.get_type() == array.get_type());
+		CHECK(decoded == array);
+	}
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
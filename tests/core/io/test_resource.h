@@ -31,6 +31,8 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/io/file_access_pack.h"
+#include "core/io/pck_packer.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -112,6 +114,40 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Loading a binary resource from a mapped pack") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Packed resource");
+	resource->set_meta("string", "A string parsed in place from the mapped pack");
+	const String save_path = TestUtils::get_temp_path("packed_resource.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	const String pck_path = TestUtils::get_temp_path("packed_resource.pck");
+	const String packed_path = "res://test_mapped_pack/packed_resource.res";
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(pck_path) == OK);
+	REQUIRE(pck_packer.add_file(packed_path, save_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+	REQUIRE(PackedData::get_singleton()->add_pack(pck_path, true, 0) == OK);
+
+	Ref<FileAccess> f = FileAccess::open(packed_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(Object::cast_to<FileAccessPack>(f.ptr()) != nullptr);
+	const uint8_t *mapped = f->get_mapped_buffer();
+	if (mapped) {
+		// Packs are only mapped where the platform supports it.
+		Vector<uint8_t> data;
+		data.resize(f->get_length());
+		CHECK(f->get_buffer(data.ptrw(), data.size()) == (uint64_t)data.size());
+		CHECK(memcmp(mapped, data.ptr(), data.size()) == 0);
+	}
+	f.unref();
+
+	const Ref<Resource> loaded = ResourceLoader::load(packed_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Packed resource");
+	CHECK(loaded->get_meta("string") == "A string parsed in place from the mapped pack");
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -166,6 +202,37 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+TEST_CASE("[Resource] Retaining more resources than the cap during a threaded load") {
+	const int resource_count = 8;
+	Vector<String> paths;
+	for (int i = 0; i < resource_count; i++) {
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name(vformat("Retained %d", i));
+		const String path = TestUtils::get_temp_path(vformat("retained_%d.res", i));
+		REQUIRE(ResourceSaver::save(resource, path) == OK);
+		paths.push_back(path);
+	}
+
+	ResourceLoader::set_max_retained_resources(2);
+
+	// Evicting retained resources frees them, which must not happen while the retained cache is locked,
+	// as a threaded load holds the loader locks while it touches that cache.
+	REQUIRE(ResourceLoader::load_threaded_request(paths[0]) == OK);
+	for (int i = 1; i < resource_count; i++) {
+		const Ref<Resource> loaded = ResourceLoader::load(paths[i]);
+		REQUIRE(loaded.is_valid());
+		CHECK(loaded->get_name() == vformat("Retained %d", i));
+	}
+
+	Error err = FAILED;
+	const Ref<Resource> threaded = ResourceLoader::load_threaded_get(paths[0], &err);
+	CHECK(err == OK);
+	REQUIRE(threaded.is_valid());
+	CHECK(threaded->get_name() == "Retained 0");
+
+	ResourceLoader::clear_retained_resources();
+	ResourceLoader::set_max_retained_resources(0);
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -374,6 +374,36 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+static Array _operands(const Variant &p_a, const Variant &p_b) {
+	Array operands;
+	operands.push_back(p_a);
+	operands.push_back(p_b);
+	return operands;
+}
+
+TEST_CASE("[Expression] Operand types changing between executions") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("foo");
+	parameter_names.push_back("bar");
+	REQUIRE(expression.parse("foo + bar", parameter_names) == OK);
+
+	// The first execution caches an evaluator for its operand types; the later ones must not reuse it for other types.
+	CHECK(expression.execute(_operands(1, 2)) == Variant(3));
+	CHECK(expression.execute(_operands(1.5, 2.25)) == Variant(3.75));
+	CHECK(expression.execute(_operands(1, 2.5)) == Variant(3.5));
+	CHECK(expression.execute(_operands("foo", "bar")) == Variant("foobar"));
+	CHECK(expression.execute(_operands(Vector2(1, 2), Vector2(3, 4))) == Variant(Vector2(4, 6)));
+	CHECK(expression.execute(_operands(40, 2)) == Variant(42));
+	CHECK(expression.execute(_operands(40, 2)).get_type() == Variant::INT);
+
+	ERR_PRINT_OFF;
+	expression.execute(_operands(1, "foo"));
+	CHECK_MESSAGE(expression.has_execute_failed(), "Invalid operand types should still be reported after caching.");
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
@@ -166,6 +166,29 @@ TEST_CASE("[String] UTF8 with CR") {
 	CHECK(no_cr == base.replace("\r", ""));
 }
 
+TEST_CASE("[String] UTF8 with long ASCII runs") {
+	// Long enough to go through the ASCII fast paths, with odd lengths and non-ASCII in between.
+	const String base = U"The quick brown fox jumps over the lazy dog.\r\nこんにちは, 0123456789 abcdefghijklmnop\rq🎤 end";
+
+	const CharString utf8 = base.utf8();
+	String keep_cr;
+	Error err = keep_cr.parse_utf8(utf8.get_data(), utf8.length());
+	CHECK(err == OK);
+	CHECK(keep_cr == base);
+
+	String no_cr;
+	err = no_cr.parse_utf8(utf8.get_data(), utf8.length(), true); // Skip CR.
+	CHECK(err == OK);
+	CHECK(no_cr == base.replace("\r", ""));
+
+	// A length past an embedded NUL stops at the NUL.
+	const char with_nul[] = "0123456789abcdef\0ghijklmnopqrstuv";
+	String until_nul;
+	err = until_nul.parse_utf8(with_nul, sizeof(with_nul) - 1);
+	CHECK(err == OK);
+	CHECK(until_nul == "0123456789abcdef");
+}
+
 TEST_CASE("[String] Invalid UTF8 (non-standard)") {
 	ERR_PRINT_OFF
 	static const uint8_t u8str[] = { 0x45, 0xE3, 0x81, 0x8A, 0xE3, 0x82, 0x88, 0xE3, 0x81, 0x86, 0xF0, 0x9F, 0x8E, 0xA4, 0xF0, 0x82, 0x82, 0xAC, 0xED, 0xA0, 0x81, 0 };
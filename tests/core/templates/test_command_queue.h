@@ -446,6 +446,139 @@ TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING,
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
+class SingleProducerState {
+public:
+	CommandQueueMT command_queue;
+	SafeFlag exit;
+	SafeNumeric<int> running;
+	SafeFlag overlapped;
+	int count = 0;
+	int sync_count = 0;
+	Thread reader_thread;
+
+	void func(int p_value) {
+		// Commands must run one at a time.
+		if (running.increment() > 1) {
+			overlapped.set();
+		}
+		// Commands must run in order.
+		if (p_value == count) {
+			count++;
+		}
+		running.decrement();
+	}
+	void func_sync(int p_value) {
+		func(p_value);
+		sync_count++;
+	}
+	int func_ret(int p_value) {
+		func(p_value);
+		return count;
+	}
+
+	static void static_reader_loop(void *p_userdata) {
+		SingleProducerState *sps = static_cast<SingleProducerState *>(p_userdata);
+		while (!sps->exit.is_set()) {
+			sps->command_queue.flush_all();
+			OS::get_singleton()->delay_usec(1);
+		}
+		sps->command_queue.flush_all();
+	}
+};
+
+TEST_CASE("[CommandQueue] Single-producer mode with a consumer thread") {
+	SingleProducerState sps;
+	sps.command_queue.set_single_producer(true, 1);
+	CHECK(sps.command_queue.is_single_producer());
+	sps.reader_thread.start(&SingleProducerState::static_reader_loop, &sps);
+
+	// Big enough to wrap around the 1 KiB ring several times.
+	const int msgs_to_add = 4096;
+	int ret = 0;
+	for (int i = 0; i < msgs_to_add; i++) {
+		if (i % 512 == 0) {
+			sps.command_queue.push_and_sync(&sps, &SingleProducerState::func_sync, i);
+			CHECK(sps.count == i + 1);
+		} else if (i % 300 == 0) {
+			sps.command_queue.push_and_ret(&sps, &SingleProducerState::func_ret, i, &ret);
+			CHECK(ret == i + 1);
+		} else {
+			sps.command_queue.push(&sps, &SingleProducerState::func, i);
+		}
+	}
+	sps.command_queue.sync();
+	CHECK_MESSAGE(sps.count == msgs_to_add, "All commands should have run in order after syncing.");
+	CHECK(sps.sync_count == 8);
+
+	sps.exit.set();
+	sps.reader_thread.wait_to_finish();
+}
+
+TEST_CASE("[CommandQueue] Single-producer mode flushed by the producer") {
+	SingleProducerState sps;
+	sps.command_queue.set_single_producer(true, 1);
+
+	sps.command_queue.push(&sps, &SingleProducerState::func, 0);
+	sps.command_queue.flush_if_pending();
+	CHECK_MESSAGE(sps.count == 1, "Flushing from the producer should publish pending commands.");
+
+	const int msgs_to_add = 1000;
+	for (int i = 1; i < msgs_to_add; i++) {
+		// Filling the ring makes the producer consume by itself, since it's also the consumer.
+		sps.command_queue.push(&sps, &SingleProducerState::func, i);
+	}
+	sps.command_queue.flush_if_pending();
+	CHECK_MESSAGE(sps.count == msgs_to_add, "All commands should have run in order after flushing.");
+
+	sps.command_queue.set_single_producer(false);
+	CHECK_FALSE(sps.command_queue.is_single_producer());
+	sps.command_queue.push(&sps, &SingleProducerState::func, msgs_to_add);
+	sps.command_queue.flush_all();
+	CHECK(sps.count == msgs_to_add + 1);
+}
+
+TEST_CASE("[CommandQueue] Single-producer mode filled before any consumer flushed") {
+	SingleProducerState sps;
+	sps.command_queue.set_single_producer(true, 1);
+
+	const int msgs_to_add = 1000;
+	for (int i = 0; i < msgs_to_add; i++) {
+		// Nobody has consumed yet, so a full ring must not wait for a consumer.
+		sps.command_queue.push(&sps, &SingleProducerState::func, i);
+	}
+	CHECK_MESSAGE(sps.count > 0, "The producer should have made room by itself.");
+
+	sps.reader_thread.start(&SingleProducerState::static_reader_loop, &sps);
+	sps.command_queue.sync();
+	sps.exit.set();
+	sps.reader_thread.wait_to_finish();
+
+	CHECK_MESSAGE(sps.count == msgs_to_add, "All commands should have run in order.");
+}
+
+TEST_CASE("[CommandQueue] Single-producer mode flushed by the producer and a consumer thread") {
+	SingleProducerState sps;
+	sps.command_queue.set_single_producer(true, 1);
+	sps.reader_thread.start(&SingleProducerState::static_reader_loop, &sps);
+
+	const int msgs_to_add = 20000;
+	for (int i = 0; i < msgs_to_add; i++) {
+		sps.command_queue.push(&sps, &SingleProducerState::func, i);
+		if (i % 7 == 0) {
+			// Races with the consumer thread for the ring.
+			sps.command_queue.flush_if_pending();
+		}
+	}
+	sps.command_queue.sync();
+
+	sps.exit.set();
+	sps.reader_thread.wait_to_finish();
+	sps.command_queue.flush_all();
+
+	CHECK_MESSAGE(sps.count == msgs_to_add, "All commands should have run in order.");
+	CHECK_FALSE_MESSAGE(sps.overlapped.is_set(), "Only one thread should consume the ring at a time.");
+}
+
 } // namespace TestCommandQueue
 
 #endif // TEST_COMMAND_QUEUE_H
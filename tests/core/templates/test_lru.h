@@ -94,6 +94,33 @@ TEST_CASE("[LRU] Resize and clear") {
 	CHECK(!lru.has(3));
 	CHECK(!lru.has(4));
 }
+static int evicted_sum = 0;
+
+static void _count_evicted(int &p_key, int &p_data) {
+	evicted_sum += p_data;
+}
+
+TEST_CASE("[LRU] Eviction callback") {
+	LRUCache<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, _count_evicted> lru;
+	evicted_sum = 0;
+
+	lru.set_capacity(2);
+	lru.insert(1, 1);
+	lru.insert(2, 2);
+	CHECK(evicted_sum == 0);
+
+	lru.insert(3, 3); // Evicts <1>.
+	CHECK(evicted_sum == 1);
+
+	lru.insert(3, 30); // Replaces <3>.
+	CHECK(evicted_sum == 4);
+
+	lru.set_capacity(1); // Evicts <2>.
+	CHECK(evicted_sum == 6);
+
+	lru.clear(); // Drops <3>.
+	CHECK(evicted_sum == 36);
+}
 } // namespace TestLRU
 
 #endif // TEST_LRU_H
@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WORK_STEALING_DEQUE_H
+#define TEST_WORK_STEALING_DEQUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner pops in LIFO order") {
+	WorkStealingDeque<uint32_t, 8> deque;
+	CHECK(deque.is_empty());
+
+	for (uint32_t i = 0; i < 5; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 5);
+
+	uint32_t value = 0;
+	for (int i = 4; i >= 0; i--) {
+		CHECK(deque.pop(value));
+		CHECK(value == (uint32_t)i);
+	}
+	CHECK_FALSE(deque.pop(value));
+	CHECK(deque.is_empty());
+}
+
+TEST_CASE("[WorkStealingDeque] Thieves steal in FIFO order") {
+	WorkStealingDeque<uint32_t, 8> deque;
+	for (uint32_t i = 0; i < 5; i++) {
+		deque.push(i);
+	}
+
+	uint32_t value = 0;
+	for (uint32_t i = 0; i < 5; i++) {
+		CHECK(deque.steal(value));
+		CHECK(value == i);
+	}
+	CHECK_FALSE(deque.steal(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full") {
+	WorkStealingDeque<uint32_t, 4> deque;
+	for (uint32_t i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(4));
+
+	uint32_t value = 0;
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.push(4));
+	CHECK(deque.size() == 4);
+}
+
+struct StealTestData {
+	WorkStealingDeque<uint32_t, 64> deque;
+	LocalVector<SafeNumeric<uint32_t>> seen;
+	SafeNumeric<uint32_t> consumed;
+	SafeFlag exit;
+};
+
+static void steal_thread_func(void *p_userdata) {
+	StealTestData *data = (StealTestData *)p_userdata;
+	uint32_t value = 0;
+	while (!data->exit.is_set()) {
+		if (data->deque.steal(value)) {
+			data->seen[value].increment();
+			data->consumed.increment();
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Every element is consumed exactly once with concurrent thieves") {
+	const uint32_t count = 100000;
+	StealTestData data;
+	data.seen.resize(count);
+
+	Thread thieves[3];
+	for (Thread &thief : thieves) {
+		thief.start(steal_thread_func, &data);
+	}
+
+	uint32_t value = 0;
+	uint32_t next = 0;
+	while (next < count) {
+		if (data.deque.push(next)) {
+			next++;
+		}
+		if (next % 3 == 0 && data.deque.pop(value)) {
+			data.seen[value].increment();
+			data.consumed.increment();
+		}
+	}
+	while (data.deque.pop(value)) {
+		data.seen[value].increment();
+		data.consumed.increment();
+	}
+	while (data.consumed.get() != count) {
+		OS::get_singleton()->delay_usec(1);
+	}
+
+	data.exit.set();
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	bool all_once = true;
+	for (uint32_t i = 0; i < count; i++) {
+		// Reduce number of check messages.
+		all_once &= data.seen[i].get() == 1;
+	}
+	CHECK(all_once);
+}
+
+static void steal_until_empty_thread_func(void *p_userdata) {
+	StealTestData *data = (StealTestData *)p_userdata;
+	uint32_t value = 0;
+	// Spin up together, so the first steals race against each other.
+	while (!data->exit.is_set()) {
+	}
+	while (data->deque.steal(value)) {
+		data->seen[value].increment();
+		data->consumed.increment();
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Steal only fails when empty") {
+	const uint32_t count = 64;
+	StealTestData data;
+	data.seen.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		CHECK(data.deque.push(i));
+	}
+
+	Thread thieves[4];
+	for (Thread &thief : thieves) {
+		thief.start(steal_until_empty_thread_func, &data);
+	}
+	data.exit.set();
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	CHECK_MESSAGE(data.deque.is_empty(), "Thieves losing a race shouldn't give up while elements are left.");
+	CHECK(data.consumed.get() == count);
+}
+
+} // namespace TestWorkStealingDeque
+
+#endif // TEST_WORK_STEALING_DEQUE_H
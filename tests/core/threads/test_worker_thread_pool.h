@@ -107,6 +107,119 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_range_group_test(void *p_arg, uint32_t p_begin, uint32_t p_end) {
+	const uint32_t grain_size = (uint32_t)(uintptr_t)p_arg;
+	if (p_end - p_begin > grain_size || p_end <= p_begin) {
+		counter[0].add(1000); // Make the test fail.
+	}
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		counter[i].increment();
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Process element ranges using range group tasks") {
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 10.0f));
+		const int grain_size = Math::pow(2.0f, Math::random(0.0f, 6.0f));
+		const bool keep_affinity = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_range_group_task(static_range_group_test, (void *)(uintptr_t)grain_size, count, grain_size, keep_affinity);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static SafeNumeric<uint32_t> dependency_order;
+
+static void static_dependency_test(void *p_arg) {
+	// Store the position at which this task ran.
+	counter[(uint64_t)p_arg].set(dependency_order.increment());
+}
+
+static void static_dependency_group_test(void *p_arg, uint32_t p_index) {
+	// All elements must see the task before the group completed.
+	if (counter[0].get() != 0) {
+		counter[1 + p_index].increment();
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Run tasks and groups after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int elements = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		dependency_order.set(0);
+		counter.clear();
+		counter.resize(elements + 3);
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		WorkerThreadPool::TaskID first = pool->add_native_task(static_dependency_test, (void *)(uintptr_t)0, !low_priority);
+		WorkerThreadPool::GroupID group = pool->add_native_group_task_with_dependencies(static_dependency_group_test, nullptr, elements, { first }, -1, low_priority);
+		WorkerThreadPool::TaskID after_group = pool->add_native_task_with_dependencies(static_dependency_test, (void *)(uintptr_t)(elements + 1), { group, first }, !low_priority);
+		WorkerThreadPool::TaskID last = pool->add_native_task_with_dependencies(static_dependency_test, (void *)(uintptr_t)(elements + 2), { after_group }, low_priority);
+
+		pool->wait_for_task_completion(last);
+		pool->wait_for_task_completion(after_group);
+		pool->wait_for_group_task_completion(group);
+		pool->wait_for_task_completion(first);
+
+		bool all_after_first = true;
+		for (int i = 0; i < elements; i++) {
+			//Reduce number of check messages
+			all_after_first &= counter[1 + i].get() == 1;
+		}
+		CHECK(all_after_first);
+		CHECK(counter[0].get() == 1);
+		CHECK(counter[elements + 1].get() == 2);
+		CHECK(counter[elements + 2].get() == 3);
+	}
+}
+
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+}
+
+static void static_nested_test(void *p_arg) {
+	// Tasks posted from a pool thread go through its own queue, from where idle threads steal them.
+	const int count = (int)(uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (int i = 0; i < count; i++) {
+		task_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_test, (void *)(uintptr_t)i, true));
+	}
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, count, -1, true);
+	for (uint32_t i = 0; i < task_ids.size(); i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 10.0f));
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(static_nested_test, (void *)(uintptr_t)count, true);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+
+		bool all_run_twice = true;
+		for (int i = 1; i < count; i++) {
+			//Reduce number of check messages
+			all_run_twice &= counter[i].get() == 2;
+		}
+		CHECK(all_run_twice);
+		CHECK(counter[0].get() == 2 * count + 2);
+	}
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -177,6 +177,19 @@ TEST_CASE("[Curve3D] Sampling") {
 		CHECK(curve->sample_baked(curve->get_closest_offset(Vector3(0, 50, 0)), true) == Vector3(0, 50, 0));
 	}
 
+	SUBCASE("sample_baked_array") {
+		PackedFloat32Array offsets;
+		offsets.push_back(0);
+		offsets.push_back(curve->get_baked_length() * 0.5);
+		offsets.push_back(curve->get_baked_length());
+		offsets.push_back(0);
+		const PackedVector3Array points = curve->sample_baked_array(offsets);
+		REQUIRE(points.size() == offsets.size());
+		for (int i = 0; i < offsets.size(); i++) {
+			CHECK(points[i].is_equal_approx(curve->sample_baked(offsets[i])));
+		}
+	}
+
 	SUBCASE("sample_baked_with_rotation, cubic = false, p_apply_tilt = false") {
 		CHECK(curve->sample_baked_with_rotation(curve->get_closest_offset(Vector3(0, 0, 0))) == Transform3D(Basis(Vector3(0, 0, -1), Vector3(1, 0, 0), Vector3(0, -1, 0)), Vector3(0, 0, 0)));
 		CHECK(curve->sample_baked_with_rotation(curve->get_closest_offset(Vector3(0, 25, 0))) == Transform3D(Basis(Vector3(0, 0, -1), Vector3(1, 0, 0), Vector3(0, -1, 0)), Vector3(0, 25, 0)));
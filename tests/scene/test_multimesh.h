@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  test_multimesh.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MULTIMESH_H
+#define TEST_MULTIMESH_H
+
+#include "scene/resources/multimesh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMultiMesh {
+
+TEST_CASE("[SceneTree][MultiMesh] Setting a range of the buffer") {
+	Ref<MultiMesh> multimesh;
+	multimesh.instantiate();
+	multimesh->set_transform_format(MultiMesh::TRANSFORM_2D);
+	multimesh->set_instance_count(4);
+
+	// Two instances, 8 floats each.
+	Vector<float> range;
+	range.resize(16);
+	for (int i = 0; i < range.size(); i++) {
+		range.write[i] = i + 1;
+	}
+	RS::get_singleton()->multimesh_set_buffer_range(multimesh->get_rid(), 1, range);
+
+	Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid());
+	REQUIRE(buffer.size() == 32);
+	bool matches = true;
+	for (int i = 0; i < buffer.size(); i++) {
+		// Reduce number of check messages.
+		float expected = (i >= 8 && i < 24) ? range[i - 8] : 0.0f;
+		matches &= buffer[i] == expected;
+	}
+	CHECK_MESSAGE(matches, "Only the given instances should be written.");
+
+	SUBCASE("Ranges past the last instance are rejected") {
+		ERR_PRINT_OFF;
+		RS::get_singleton()->multimesh_set_buffer_range(multimesh->get_rid(), 3, range);
+		ERR_PRINT_ON;
+		CHECK(RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid()) == buffer);
+	}
+
+	SUBCASE("Buffers that aren't a whole number of instances are rejected") {
+		range.resize(10);
+		ERR_PRINT_OFF;
+		RS::get_singleton()->multimesh_set_buffer_range(multimesh->get_rid(), 0, range);
+		ERR_PRINT_ON;
+		CHECK(RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid()) == buffer);
+	}
+}
+
+} // namespace TestMultiMesh
+
+#endif // TEST_MULTIMESH_H
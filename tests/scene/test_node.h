@@ -499,6 +499,50 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 	memdelete(node2);
 }
 
+TEST_CASE("[Node] Removing children keeps the order of the remaining ones") {
+	Node *parent = memnew(Node);
+	Node *internal_front = memnew(Node);
+	Node *internal_back = memnew(Node);
+	parent->add_child(internal_front, false, Node::INTERNAL_MODE_FRONT);
+
+	Vector<Node *> children;
+	for (int i = 0; i < 6; i++) {
+		Node *child = memnew(Node);
+		parent->add_child(child);
+		children.push_back(child);
+	}
+	parent->add_child(internal_back, false, Node::INTERNAL_MODE_BACK);
+	CHECK_EQ(parent->get_child_count(), 6);
+
+	// Several removals in a row, without the children being queried in between.
+	parent->remove_child(children[1]);
+	parent->remove_child(children[4]);
+	parent->remove_child(children[0]);
+	parent->remove_child(internal_back);
+
+	CHECK_EQ(parent->get_child_count(), 3);
+	CHECK_EQ(parent->get_child_count(true), 4);
+	CHECK_EQ(parent->get_child(0, true), internal_front);
+	CHECK_EQ(parent->get_child(0), children[2]);
+	CHECK_EQ(parent->get_child(1), children[3]);
+	CHECK_EQ(parent->get_child(2), children[5]);
+	CHECK_EQ(children[2]->get_index(), 0);
+	CHECK_EQ(children[5]->get_index(), 2);
+
+	// Adding after removals must still append at the end.
+	parent->add_child(children[0]);
+	parent->remove_child(children[3]);
+	CHECK_EQ(parent->get_child_count(), 3);
+	CHECK_EQ(parent->get_child(2), children[0]);
+	CHECK_EQ(children[0]->get_index(), 2);
+
+	memdelete(parent);
+	memdelete(internal_back);
+	memdelete(children[1]);
+	memdelete(children[3]);
+	memdelete(children[4]);
+}
+
 TEST_CASE("[SceneTree][Node]Exported node checks") {
 	TestNode *node = memnew(TestNode);
 	SceneTree::get_singleton()->get_root()->add_child(node);
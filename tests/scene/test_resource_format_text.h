@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_resource_format_text.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RESOURCE_FORMAT_TEXT_H
+#define TEST_RESOURCE_FORMAT_TEXT_H
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/resource_format_binary.h"
+#include "scene/resources/resource_format_text.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestResourceFormatText {
+
+#ifdef TOOLS_ENABLED
+static void write_text_resource(const String &p_path, const String &p_name) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string("[gd_resource type=\"Resource\" format=3]\n\n[resource]\nresource_name = \"" + p_name + "\"\n");
+}
+
+static String load_resource_name(const String &p_path) {
+	Error err = FAILED;
+	Ref<Resource> res = ResourceFormatLoaderText::singleton->load(p_path, "", &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	if (err != OK || res.is_null()) {
+		return String();
+	}
+	return res->get_name();
+}
+
+TEST_CASE("[ResourceFormatText] Binary cache") {
+	const String cache_dir = TestUtils::get_temp_path("text_resource_cache");
+	const String source_path = TestUtils::get_temp_path("cached_resource.tres");
+
+	bool old_use_binary_cache = ResourceFormatLoaderText::use_binary_cache;
+	String old_binary_cache_dir = ResourceFormatLoaderText::binary_cache_dir;
+	ResourceFormatLoaderText::use_binary_cache = true;
+	ResourceFormatLoaderText::binary_cache_dir = cache_dir;
+
+	const String cache_path = ResourceFormatLoaderText::get_binary_cache_path(source_path);
+	DirAccess::remove_absolute(cache_path);
+	DirAccess::remove_absolute(cache_path + ".md5");
+
+	SUBCASE("Miss writes a cache entry") {
+		write_text_resource(source_path, "first");
+		CHECK(load_resource_name(source_path) == "first");
+		CHECK(FileAccess::exists(cache_path));
+		CHECK(FileAccess::exists(cache_path + ".md5"));
+	}
+
+	SUBCASE("Hit loads the cache entry") {
+		write_text_resource(source_path, "first");
+		CHECK(load_resource_name(source_path) == "first");
+
+		// Replace the entry with a different resource, so loading it can be told apart from parsing the text.
+		Ref<Resource> cached;
+		cached.instantiate();
+		cached->set_name("cached");
+		REQUIRE(ResourceFormatSaverBinary::singleton->save(cached, cache_path) == OK);
+
+		CHECK_MESSAGE(load_resource_name(source_path) == "cached", "An unmodified source should load from the cache.");
+	}
+
+	SUBCASE("Editing the source invalidates the cache entry") {
+		write_text_resource(source_path, "first");
+		CHECK(load_resource_name(source_path) == "first");
+
+		write_text_resource(source_path, "second version");
+		CHECK_MESSAGE(load_resource_name(source_path) == "second version", "A modified source should be parsed again.");
+
+		// The entry was replaced rather than added next to the old one.
+		Ref<DirAccess> da = DirAccess::open(cache_dir);
+		REQUIRE(da.is_valid());
+		CHECK(da->get_files().size() == 2);
+
+		Ref<ResourceFormatLoaderBinary> binary_loader;
+		binary_loader.instantiate();
+		Ref<Resource> cached = binary_loader->load(cache_path, source_path, nullptr, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE(cached.is_valid());
+		CHECK(cached->get_name() == "second version");
+	}
+
+	ResourceFormatLoaderText::use_binary_cache = old_use_binary_cache;
+	ResourceFormatLoaderText::binary_cache_dir = old_binary_cache_dir;
+}
+#endif // TOOLS_ENABLED
+
+} // namespace TestResourceFormatText
+
+#endif // TEST_RESOURCE_FORMAT_TEXT_H
@@ -34,6 +34,7 @@
 #include "tests/test_macros.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
 
 namespace TestSkeleton3D {
 
@@ -73,6 +74,43 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[SceneTree][Skeleton3D] Global poses follow pose changes") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->add_bone("root");
+	skeleton->add_bone("arm");
+	skeleton->add_bone("hand");
+	skeleton->add_bone("leg");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_parent(3, 0);
+	for (int i = 0; i < skeleton->get_bone_count(); i++) {
+		skeleton->set_bone_rest(i, Transform3D(Basis(), Vector3(0, 1, 0)));
+		skeleton->reset_bone_pose(i);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 3, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 0)));
+
+	// Changing a bone moves its descendants only.
+	skeleton->set_bone_pose_position(1, Vector3(1, 1, 0));
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 2, 0)));
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(1, 3, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 0)));
+
+	// Changing a bone and one of its descendants in the same update.
+	skeleton->set_bone_pose_position(2, Vector3(0, 2, 0));
+	skeleton->set_bone_pose_position(0, Vector3(0, 0, 1));
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(1, 3, 1)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 1, 1)));
+
+	// Bone disabling still affects the whole skeleton.
+	skeleton->set_bone_enabled(1, false);
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 3, 1)));
+
+	memdelete(skeleton);
+}
 } // namespace TestSkeleton3D
 
 #endif // TEST_SKELETON_3D_H
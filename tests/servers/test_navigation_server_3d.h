@@ -790,6 +790,35 @@ TEST_SUITE("[Navigation]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Async queries should yield the same results as synchronous ones on a later process") {
+			CallableMock mock;
+			const int query_count = 3;
+			Ref<NavigationPathQueryResult3D> sync_results[query_count];
+			Ref<NavigationPathQueryResult3D> async_results[query_count];
+			for (int i = 0; i < query_count; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(i, 0, 0));
+				query_parameters->set_target_position(Vector3(10, 0, 10 - i));
+				sync_results[i].instantiate();
+				navigation_server->query_path(query_parameters, sync_results[i]);
+				async_results[i].instantiate();
+				navigation_server->query_path_async(query_parameters, async_results[i], callable_mp(&mock, &CallableMock::function1));
+			}
+			CHECK_EQ(mock.function1_calls, 0);
+
+			navigation_server->process(0.0); // Starts the queued queries.
+			navigation_server->process(0.0); // Delivers their results.
+			CHECK_EQ(mock.function1_calls, query_count);
+			CHECK_EQ(mock.function1_latest_arg0, Variant(async_results[query_count - 1]));
+			for (int i = 0; i < query_count; i++) {
+				CHECK_NE(async_results[i]->get_path().size(), 0);
+				CHECK_EQ(async_results[i]->get_path(), sync_results[i]->get_path());
+				CHECK_EQ(async_results[i]->get_path_types(), sync_results[i]->get_path_types());
+				CHECK_EQ(async_results[i]->get_path_owner_ids(), sync_results[i]->get_path_owner_ids());
+			}
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->process(0.0); // Give server some cycles to commit.
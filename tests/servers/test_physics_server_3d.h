@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_H
+#define TEST_PHYSICS_SERVER_3D_H
+
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+static void check_batched_rays(PhysicsDirectSpaceState3D *p_state, const PhysicsDirectSpaceState3D::RayParameters &p_parameters, const Vector<Vector3> &p_from, const Vector<Vector3> &p_to) {
+	const int count = p_from.size();
+	Vector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(count);
+	Vector<uint8_t> hits;
+	hits.resize(count);
+
+	const int hit_count = p_state->intersect_rays(p_parameters, p_from.ptr(), p_to.ptr(), count, results.ptrw(), hits.ptrw());
+
+	int expected_hit_count = 0;
+	PhysicsDirectSpaceState3D::RayParameters parameters = p_parameters;
+	for (int i = 0; i < count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		PhysicsDirectSpaceState3D::RayResult expected;
+		const bool hit = p_state->intersect_ray(parameters, expected);
+		CHECK_MESSAGE(hits[i] == (hit ? 1 : 0), vformat("Ray %d should report the same hit as a single query.", i));
+		if (hit) {
+			expected_hit_count++;
+			CHECK(results[i].position == expected.position);
+			CHECK(results[i].normal == expected.normal);
+			CHECK(results[i].rid == expected.rid);
+			CHECK(results[i].collider_id == expected.collider_id);
+			CHECK(results[i].shape == expected.shape);
+			CHECK(results[i].face_index == expected.face_index);
+		}
+	}
+	CHECK(hit_count == expected_hit_count);
+}
+
+TEST_CASE("[PhysicsServer3D][SceneTree] Batched ray queries should match single ray queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+	if (!space.is_valid()) {
+		// The dummy physics server has no spaces.
+		return;
+	}
+	PhysicsDirectSpaceState3D *state = physics_server->space_get_direct_state(space);
+	REQUIRE(state != nullptr);
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(1, 1, 1));
+	RID bodies[2];
+	for (int i = 0; i < 2; i++) {
+		bodies[i] = physics_server->body_create();
+		physics_server->body_set_mode(bodies[i], PhysicsServer3D::BODY_MODE_STATIC);
+		physics_server->body_add_shape(bodies[i], shape);
+		physics_server->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 5, 0, 0)));
+		physics_server->body_set_space(bodies[i], space);
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+
+	SUBCASE("Empty batch") {
+		CHECK(state->intersect_rays(parameters, nullptr, nullptr, 0, nullptr, nullptr) == 0);
+	}
+
+	SUBCASE("Batch where every ray misses") {
+		Vector<Vector3> from;
+		Vector<Vector3> to;
+		for (int i = 0; i < 8; i++) {
+			from.push_back(Vector3(i, 10, -10));
+			to.push_back(Vector3(i, 10, 10));
+		}
+		check_batched_rays(state, parameters, from, to);
+
+		Vector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(from.size());
+		Vector<uint8_t> hits;
+		hits.resize(from.size());
+		CHECK(state->intersect_rays(parameters, from.ptr(), to.ptr(), from.size(), results.ptrw(), hits.ptrw()) == 0);
+		for (int i = 0; i < hits.size(); i++) {
+			CHECK(hits[i] == 0);
+		}
+	}
+
+	SUBCASE("Mixed batches, small and large enough to be split across threads") {
+		const int counts[] = { 5, 1000 };
+		for (const int count : counts) {
+			Vector<Vector3> from;
+			Vector<Vector3> to;
+			for (int i = 0; i < count; i++) {
+				// Sweeps across both boxes and the gaps around them.
+				const real_t x = -3.0 + 11.0 * i / count;
+				from.push_back(Vector3(x, 0.5, -10));
+				to.push_back(Vector3(x, 0.5, 10));
+			}
+			check_batched_rays(state, parameters, from, to);
+		}
+	}
+
+	for (int i = 0; i < 2; i++) {
+		physics_server->free(bodies[i]);
+	}
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // TEST_PHYSICS_SERVER_3D_H